@@ -238,8 +238,31 @@ template<class T> complex<T> sqrt (const complex<T>&);
 template<class T> complex<T> tan (const complex<T>&);
 template<class T> complex<T> tanh (const complex<T>&);
 
+// Layout compatibility with std::complex (T is float or double):
+template<class T>       complex<T>*      as_cplx(std::complex<T>*);
+template<class T> const complex<T>*      as_cplx(const std::complex<T>*);
+template<class T>       std::complex<T>* as_std(complex<T>*);
+template<class T> const std::complex<T>* as_std(const complex<T>*);
+template<class T, int D>
+  sycl::buffer<complex<T>, D>      as_cplx(sycl::buffer<std::complex<T>, D>&);
+template<class T, int D>
+  sycl::buffer<std::complex<T>, D> as_std(sycl::buffer<complex<T>, D>&);
+
 }  // sycl::ext::cplx
 
+namespace sycl
+{
+
+// Reduction identities, so sycl::reduction over complex<T> (T is half, float
+// or double) takes the same path as over arithmetic types:
+template<class T> struct known_identity<plus<ext::cplx::complex<T>>, ext::cplx::complex<T>>;       // (0, 0)
+template<class T> struct known_identity<plus<void>, ext::cplx::complex<T>>;                        // (0, 0)
+template<class T> struct known_identity<multiplies<ext::cplx::complex<T>>, ext::cplx::complex<T>>; // (1, 0)
+template<class T> struct known_identity<multiplies<void>, ext::cplx::complex<T>>;                  // (1, 0)
+// and the matching has_known_identity specializations.
+
+}  // sycl
+
 */
 
 // clang-format on
@@ -744,6 +767,71 @@ inline constexpr complex<double>::complex(const complex<sycl::half> &__c)
 inline constexpr complex<double>::complex(const complex<float> &__c)
     : __re_(__c.real()), __im_(__c.imag()) {}
 
+// Layout compatibility with std::complex
+
+// complex<float> and complex<double> hold the real part followed by the
+// imaginary part and nothing else, which is the array-of-two layout the C++
+// standard requires of std::complex<float> and std::complex<double>. Arrays of
+// either type can therefore be reinterpreted in place with as_cplx and as_std
+// instead of being converted element by element. Within one function, access
+// a given allocation through only one of the two types.
+
+template <class _Tp, class _Sp>
+struct __has_std_complex_layout
+    : std::integral_constant<bool, sizeof(_Tp) == sizeof(_Sp) &&
+                                       alignof(_Tp) == alignof(_Sp) &&
+                                       std::is_standard_layout_v<_Tp> &&
+                                       std::is_trivially_copyable_v<_Tp>> {};
+
+static_assert(
+    __has_std_complex_layout<complex<float>, std::complex<float>>::value,
+    "complex<float> must be layout compatible with std::complex");
+static_assert(
+    __has_std_complex_layout<complex<double>, std::complex<double>>::value,
+    "complex<double> must be layout compatible with std::complex");
+
+template <class _Tp>
+struct __is_std_interop
+    : std::integral_constant<bool, std::is_same_v<_Tp, float> ||
+                                       std::is_same_v<_Tp, double>> {};
+
+template <class _Tp, class = std::enable_if_t<__is_std_interop<_Tp>::value>>
+_SYCL_EXT_CPLX_INLINE_VISIBILITY complex<_Tp> *
+as_cplx(std::complex<_Tp> *__p) {
+  return reinterpret_cast<complex<_Tp> *>(__p);
+}
+
+template <class _Tp, class = std::enable_if_t<__is_std_interop<_Tp>::value>>
+_SYCL_EXT_CPLX_INLINE_VISIBILITY const complex<_Tp> *
+as_cplx(const std::complex<_Tp> *__p) {
+  return reinterpret_cast<const complex<_Tp> *>(__p);
+}
+
+template <class _Tp, class = std::enable_if_t<__is_std_interop<_Tp>::value>>
+_SYCL_EXT_CPLX_INLINE_VISIBILITY std::complex<_Tp> *as_std(complex<_Tp> *__p) {
+  return reinterpret_cast<std::complex<_Tp> *>(__p);
+}
+
+template <class _Tp, class = std::enable_if_t<__is_std_interop<_Tp>::value>>
+_SYCL_EXT_CPLX_INLINE_VISIBILITY const std::complex<_Tp> *
+as_std(const complex<_Tp> *__p) {
+  return reinterpret_cast<const std::complex<_Tp> *>(__p);
+}
+
+template <class _Tp, int _Dims,
+          class = std::enable_if_t<__is_std_interop<_Tp>::value>>
+sycl::buffer<complex<_Tp>, _Dims>
+as_cplx(sycl::buffer<std::complex<_Tp>, _Dims> &__b) {
+  return __b.template reinterpret<complex<_Tp>, _Dims>(__b.get_range());
+}
+
+template <class _Tp, int _Dims,
+          class = std::enable_if_t<__is_std_interop<_Tp>::value>>
+sycl::buffer<std::complex<_Tp>, _Dims>
+as_std(sycl::buffer<complex<_Tp>, _Dims> &__b) {
+  return __b.template reinterpret<std::complex<_Tp>, _Dims>(__b.get_range());
+}
+
 // 26.3.6 operators:
 
 template <class _Tp>
@@ -1520,6 +1608,48 @@ operator<<(const sycl::stream &__ss, const complex<_Tp> &_x) {
 
 _SYCL_EXT_CPLX_END_NAMESPACE_STD
 
+// Reduction identities
+//
+// sycl::reduction only uses its identity-based reduction path when the
+// identity of the operator is known at compile time. Without these, reducing
+// complex values needs an explicit identity argument or falls back to a
+// slower generic implementation.
+
+namespace sycl {
+
+template <class _Tp>
+struct has_known_identity<plus<ext::cplx::complex<_Tp>>,
+                          ext::cplx::complex<_Tp>> : std::true_type {};
+template <class _Tp>
+struct has_known_identity<plus<void>, ext::cplx::complex<_Tp>>
+    : std::true_type {};
+template <class _Tp>
+struct has_known_identity<multiplies<ext::cplx::complex<_Tp>>,
+                          ext::cplx::complex<_Tp>> : std::true_type {};
+template <class _Tp>
+struct has_known_identity<multiplies<void>, ext::cplx::complex<_Tp>>
+    : std::true_type {};
+
+template <class _Tp>
+struct known_identity<plus<ext::cplx::complex<_Tp>>, ext::cplx::complex<_Tp>> {
+  static constexpr ext::cplx::complex<_Tp> value{_Tp(0), _Tp(0)};
+};
+template <class _Tp>
+struct known_identity<plus<void>, ext::cplx::complex<_Tp>> {
+  static constexpr ext::cplx::complex<_Tp> value{_Tp(0), _Tp(0)};
+};
+template <class _Tp>
+struct known_identity<multiplies<ext::cplx::complex<_Tp>>,
+                      ext::cplx::complex<_Tp>> {
+  static constexpr ext::cplx::complex<_Tp> value{_Tp(1), _Tp(0)};
+};
+template <class _Tp>
+struct known_identity<multiplies<void>, ext::cplx::complex<_Tp>> {
+  static constexpr ext::cplx::complex<_Tp> value{_Tp(1), _Tp(0)};
+};
+
+} // namespace sycl
+
 #undef _SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD
 #undef _SYCL_EXT_CPLX_END_NAMESPACE_STD
 #undef _SYCL_EXT_CPLX_INLINE_VISIBILITY
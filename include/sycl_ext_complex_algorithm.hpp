@@ -0,0 +1,460 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the SyclCPLX project, under the Apache License v2.0 with LLVM
+// Exceptions. See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _SYCL_EXT_CPLX_COMPLEX_ALGORITHM
+#define _SYCL_EXT_CPLX_COMPLEX_ALGORITHM
+
+// clang-format off
+
+/*
+    algorithm synopsis
+
+namespace sycl::ext::cplx
+{
+
+// Function objects for every math function and operator of
+// sycl_ext_complex.hpp, usable on the host and in kernels.
+namespace op
+{
+    // unary
+    inline constexpr unspecified abs, arg, norm, conj, proj,
+                                 exp, log, log10, sqrt,
+                                 sin, cos, tan, asin, acos, atan,
+                                 sinh, cosh, tanh, asinh, acosh, atanh;
+    // binary
+    inline constexpr unspecified pow, plus, minus, multiplies, divides;
+
+    // x * y by the textbook formula, without the recovery of infinities from
+    // NaN intermediates done by operator*. For finite, well-scaled operands
+    // such as unit phasors.
+    inline constexpr unspecified limited_range_multiplies;
+}
+
+// out[i] = op(in[i]) for i in [0, n)
+template<class In, class Out, class UnaryOp>
+  sycl::event transform(sycl::queue&, const In* in, Out* out, size_t n,
+                        UnaryOp op, const std::vector<sycl::event>& deps = {});
+
+// out[i] = op(in1[i], in2[i]) for i in [0, n)
+template<class In1, class In2, class Out, class BinaryOp>
+  sycl::event transform(sycl::queue&, const In1* in1, const In2* in2, Out* out,
+                        size_t n, BinaryOp op,
+                        const std::vector<sycl::event>& deps = {});
+
+// Buffer forms, over the whole of out. Throw std::invalid_argument if an
+// input buffer is shorter than out.
+template<class In, class Out, class UnaryOp>
+  sycl::event transform(sycl::queue&, sycl::buffer<In, 1>& in,
+                        sycl::buffer<Out, 1>& out, UnaryOp op);
+template<class In1, class In2, class Out, class BinaryOp>
+  sycl::event transform(sycl::queue&, sycl::buffer<In1, 1>& in1,
+                        sycl::buffer<In2, 1>& in2, sycl::buffer<Out, 1>& out,
+                        BinaryOp op);
+
+// Device-wide scans in a single pass over the data (decoupled look-back).
+// op must be associative, for example op::plus, op::multiplies or
+// op::limited_range_multiplies. in and out may be the same array.
+//
+// out[i] = in[0] op ... op in[i]
+template<class T, class BinaryOp>
+  sycl::event inclusive_scan(sycl::queue&, const complex<T>* in, complex<T>* out,
+                             size_t n, BinaryOp op,
+                             const std::vector<sycl::event>& deps = {});
+// out[i] = init op in[0] op ... op in[i - 1]
+template<class T, class BinaryOp>
+  sycl::event exclusive_scan(sycl::queue&, const complex<T>* in, complex<T>* out,
+                             size_t n, complex<T> init, BinaryOp op,
+                             const std::vector<sycl::event>& deps = {});
+
+}  // sycl::ext::cplx
+
+*/
+
+// clang-format on
+
+#include "sycl_ext_complex.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+#define _SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD namespace sycl::ext::cplx {
+#define _SYCL_EXT_CPLX_END_NAMESPACE_STD }
+#define _SYCL_EXT_CPLX_INLINE_VISIBILITY                                       \
+  inline __attribute__((__visibility__("hidden"), __always_inline__))
+
+_SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD
+
+namespace op {
+
+#define _SYCL_EXT_CPLX_UNARY_OP(__name)                                        \
+  struct __name##_fn {                                                         \
+    template <class _Tp>                                                       \
+    _SYCL_EXT_CPLX_INLINE_VISIBILITY auto operator()(const _Tp &__x) const {   \
+      return sycl::ext::cplx::__name(__x);                                     \
+    }                                                                          \
+  };                                                                           \
+  inline constexpr __name##_fn __name{};
+
+_SYCL_EXT_CPLX_UNARY_OP(abs)
+_SYCL_EXT_CPLX_UNARY_OP(arg)
+_SYCL_EXT_CPLX_UNARY_OP(norm)
+_SYCL_EXT_CPLX_UNARY_OP(conj)
+_SYCL_EXT_CPLX_UNARY_OP(proj)
+_SYCL_EXT_CPLX_UNARY_OP(exp)
+_SYCL_EXT_CPLX_UNARY_OP(log)
+_SYCL_EXT_CPLX_UNARY_OP(log10)
+_SYCL_EXT_CPLX_UNARY_OP(sqrt)
+_SYCL_EXT_CPLX_UNARY_OP(sin)
+_SYCL_EXT_CPLX_UNARY_OP(cos)
+_SYCL_EXT_CPLX_UNARY_OP(tan)
+_SYCL_EXT_CPLX_UNARY_OP(asin)
+_SYCL_EXT_CPLX_UNARY_OP(acos)
+_SYCL_EXT_CPLX_UNARY_OP(atan)
+_SYCL_EXT_CPLX_UNARY_OP(sinh)
+_SYCL_EXT_CPLX_UNARY_OP(cosh)
+_SYCL_EXT_CPLX_UNARY_OP(tanh)
+_SYCL_EXT_CPLX_UNARY_OP(asinh)
+_SYCL_EXT_CPLX_UNARY_OP(acosh)
+_SYCL_EXT_CPLX_UNARY_OP(atanh)
+
+#undef _SYCL_EXT_CPLX_UNARY_OP
+
+struct pow_fn {
+  template <class _Tp, class _Up>
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY auto operator()(const _Tp &__x,
+                                                   const _Up &__y) const {
+    return sycl::ext::cplx::pow(__x, __y);
+  }
+};
+inline constexpr pow_fn pow{};
+
+#define _SYCL_EXT_CPLX_BINARY_OP(__name, __op)                                 \
+  struct __name##_fn {                                                         \
+    template <class _Tp, class _Up>                                            \
+    _SYCL_EXT_CPLX_INLINE_VISIBILITY auto operator()(const _Tp &__x,           \
+                                                     const _Up &__y) const {   \
+      return __x __op __y;                                                     \
+    }                                                                          \
+  };                                                                           \
+  inline constexpr __name##_fn __name{};
+
+_SYCL_EXT_CPLX_BINARY_OP(plus, +)
+_SYCL_EXT_CPLX_BINARY_OP(minus, -)
+_SYCL_EXT_CPLX_BINARY_OP(multiplies, *)
+_SYCL_EXT_CPLX_BINARY_OP(divides, /)
+
+#undef _SYCL_EXT_CPLX_BINARY_OP
+
+struct limited_range_multiplies_fn {
+  template <class _Tp>
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY complex<_Tp>
+  operator()(const complex<_Tp> &__x, const complex<_Tp> &__y) const {
+    return complex<_Tp>(__x.real() * __y.real() - __x.imag() * __y.imag(),
+                        __x.real() * __y.imag() + __x.imag() * __y.real());
+  }
+};
+inline constexpr limited_range_multiplies_fn limited_range_multiplies{};
+
+} // namespace op
+
+// Launch shape for memory-bound elementwise kernels. Work-groups are sized
+// from the device limits, and only enough of them are launched to keep every
+// compute unit busy; each work-item then strides over the remainder, which
+// keeps accesses coalesced on GPUs and amortizes launch overhead on CPUs.
+struct __launch_config {
+  std::size_t __wg;
+  std::size_t __groups;
+
+  sycl::nd_range<1> __range() const {
+    return sycl::nd_range<1>(__wg * __groups, __wg);
+  }
+};
+
+inline __launch_config __elementwise_config(const sycl::device &__d,
+                                            std::size_t __n) {
+  const bool __gpu = __d.is_gpu();
+  const std::size_t __max_wg =
+      __d.get_info<sycl::info::device::max_work_group_size>();
+  const std::size_t __cu =
+      __d.get_info<sycl::info::device::max_compute_units>();
+  const std::size_t __wg = std::min<std::size_t>(__gpu ? 256 : 64, __max_wg);
+  // GPUs need several resident groups per compute unit to hide latency.
+  const std::size_t __max_groups = std::max<std::size_t>(1, __cu) *
+                                   (__gpu ? 16 : 4);
+  const std::size_t __needed = (__n + __wg - 1) / __wg;
+  return {__wg, std::max<std::size_t>(
+                    1, std::min<std::size_t>(__needed, __max_groups))};
+}
+
+// Frees temporary USM allocations once __e has completed. The returned event
+// completes after both.
+template <class... _Ptrs>
+sycl::event __free_after(sycl::queue &__q, sycl::event __e, _Ptrs... __ptrs) {
+  return __q.submit([&](sycl::handler &__cgh) {
+    __cgh.depends_on(__e);
+    const sycl::context __ctx = __q.get_context();
+    __cgh.host_task([=] { (sycl::free(__ptrs, __ctx), ...); });
+  });
+}
+
+// transform
+
+template <class _In, class _Out, class _UnaryOp>
+sycl::event transform(sycl::queue &__q, const _In *__in, _Out *__out,
+                      std::size_t __n, _UnaryOp __op,
+                      const std::vector<sycl::event> &__deps = {}) {
+  const __launch_config __cfg = __elementwise_config(__q.get_device(), __n);
+  return __q.submit([&](sycl::handler &__cgh) {
+    __cgh.depends_on(__deps);
+    __cgh.parallel_for(__cfg.__range(), [=](sycl::nd_item<1> __it) {
+      const std::size_t __stride = __it.get_global_range(0);
+      for (std::size_t __i = __it.get_global_id(0); __i < __n; __i += __stride)
+        __out[__i] = __op(__in[__i]);
+    });
+  });
+}
+
+template <class _In1, class _In2, class _Out, class _BinaryOp>
+sycl::event transform(sycl::queue &__q, const _In1 *__in1, const _In2 *__in2,
+                      _Out *__out, std::size_t __n, _BinaryOp __op,
+                      const std::vector<sycl::event> &__deps = {}) {
+  const __launch_config __cfg = __elementwise_config(__q.get_device(), __n);
+  return __q.submit([&](sycl::handler &__cgh) {
+    __cgh.depends_on(__deps);
+    __cgh.parallel_for(__cfg.__range(), [=](sycl::nd_item<1> __it) {
+      const std::size_t __stride = __it.get_global_range(0);
+      for (std::size_t __i = __it.get_global_id(0); __i < __n; __i += __stride)
+        __out[__i] = __op(__in1[__i], __in2[__i]);
+    });
+  });
+}
+
+template <class _In, class _Out, class _UnaryOp>
+sycl::event transform(sycl::queue &__q, sycl::buffer<_In, 1> &__in,
+                      sycl::buffer<_Out, 1> &__out, _UnaryOp __op) {
+  const std::size_t __n = __out.size();
+  if (__in.size() < __n)
+    throw std::invalid_argument("transform input buffer is shorter than out");
+  const __launch_config __cfg = __elementwise_config(__q.get_device(), __n);
+  return __q.submit([&](sycl::handler &__cgh) {
+    sycl::accessor __a(__in, __cgh, sycl::read_only);
+    sycl::accessor __r(__out, __cgh, sycl::write_only, sycl::no_init);
+    __cgh.parallel_for(__cfg.__range(), [=](sycl::nd_item<1> __it) {
+      const std::size_t __stride = __it.get_global_range(0);
+      for (std::size_t __i = __it.get_global_id(0); __i < __n; __i += __stride)
+        __r[__i] = __op(__a[__i]);
+    });
+  });
+}
+
+template <class _In1, class _In2, class _Out, class _BinaryOp>
+sycl::event transform(sycl::queue &__q, sycl::buffer<_In1, 1> &__in1,
+                      sycl::buffer<_In2, 1> &__in2,
+                      sycl::buffer<_Out, 1> &__out, _BinaryOp __op) {
+  const std::size_t __n = __out.size();
+  if (__in1.size() < __n || __in2.size() < __n)
+    throw std::invalid_argument("transform input buffer is shorter than out");
+  const __launch_config __cfg = __elementwise_config(__q.get_device(), __n);
+  return __q.submit([&](sycl::handler &__cgh) {
+    sycl::accessor __a(__in1, __cgh, sycl::read_only);
+    sycl::accessor __b(__in2, __cgh, sycl::read_only);
+    sycl::accessor __r(__out, __cgh, sycl::write_only, sycl::no_init);
+    __cgh.parallel_for(__cfg.__range(), [=](sycl::nd_item<1> __it) {
+      const std::size_t __stride = __it.get_global_range(0);
+      for (std::size_t __i = __it.get_global_id(0); __i < __n; __i += __stride)
+        __r[__i] = __op(__a[__i], __b[__i]);
+    });
+  });
+}
+
+// Device-wide scans
+//
+// Single-pass scan with decoupled look-back. Each work-group takes the next
+// tile from an atomic counter, scans it in local memory and publishes the
+// tile aggregate. Its first work-item then walks back over the preceding
+// tiles, combining their aggregates until it meets a tile whose inclusive
+// prefix is already known, and publishes the prefix of its own tile. Taking
+// tiles from a counter rather than from the group id guarantees every tile
+// being waited on belongs to a work-group that has already started.
+
+enum __scan_status : int { __scan_invalid, __scan_aggregate, __scan_prefix };
+
+template <class _Tp, class _BinaryOp>
+sycl::event __device_scan(sycl::queue &__q, const complex<_Tp> *__in,
+                          complex<_Tp> *__out, std::size_t __n, _BinaryOp __op,
+                          bool __exclusive, complex<_Tp> __init,
+                          const std::vector<sycl::event> &__deps) {
+  typedef complex<_Tp> _Cp;
+  typedef sycl::atomic_ref<int, sycl::memory_order::acq_rel,
+                           sycl::memory_scope::device,
+                           sycl::access::address_space::global_space>
+      _Flag;
+
+  if (__n == 0)
+    return __q.submit([&](sycl::handler &__cgh) {
+      __cgh.depends_on(__deps);
+      __cgh.single_task([=] {});
+    });
+
+  // Elements per work-item, keeping the tile within 32 KiB of local memory.
+  constexpr std::size_t __k = sizeof(_Tp) > 4 ? 4 : 8;
+  const std::size_t __wg = __elementwise_config(__q.get_device(), __n).__wg;
+  const std::size_t __tile = __wg * __k;
+  const std::size_t __tiles = (__n + __tile - 1) / __tile;
+
+  // Tile status flags followed by the tile counter, then the published
+  // aggregates and inclusive prefixes.
+  int *__flags = sycl::malloc_device<int>(__tiles + 1, __q);
+  _Cp *__states = sycl::malloc_device<_Cp>(2 * __tiles, __q);
+  if (!__flags || !__states) {
+    sycl::free(__flags, __q);
+    sycl::free(__states, __q);
+    throw std::bad_alloc();
+  }
+  sycl::event __reset = __q.memset(__flags, 0, (__tiles + 1) * sizeof(int));
+
+  sycl::event __e = __q.submit([&](sycl::handler &__cgh) {
+    __cgh.depends_on(__deps);
+    __cgh.depends_on(__reset);
+    sycl::local_accessor<_Cp, 1> __tile_mem(sycl::range<1>(__tile), __cgh);
+    sycl::local_accessor<_Cp, 1> __item_mem(sycl::range<1>(__wg), __cgh);
+    sycl::local_accessor<_Cp, 1> __prefix_mem(sycl::range<1>(1), __cgh);
+    sycl::local_accessor<std::size_t, 1> __id_mem(sycl::range<1>(1), __cgh);
+    __cgh.parallel_for(
+        sycl::nd_range<1>(__tiles * __wg, __wg), [=](sycl::nd_item<1> __it) {
+          const auto __g = __it.get_group();
+          const std::size_t __lid = __it.get_local_id(0);
+          _Cp *__aggregates = __states;
+          _Cp *__prefixes = __states + __tiles;
+
+          if (__lid == 0)
+            __id_mem[0] = _Flag(__flags[__tiles])
+                              .fetch_add(1, sycl::memory_order::relaxed);
+          sycl::group_barrier(__g);
+          const std::size_t __t = __id_mem[0];
+          const std::size_t __base = __t * __tile;
+          const std::size_t __count = sycl::min(__tile, __n - __base);
+
+          for (std::size_t __i = __lid; __i < __count; __i += __wg)
+            __tile_mem[__i] = __in[__base + __i];
+          sycl::group_barrier(__g);
+
+          // Each work-item scans its own run of __k elements.
+          const std::size_t __first = __lid * __k;
+          const std::size_t __mine =
+              __first < __count ? sycl::min(__k, __count - __first) : 0;
+          _Cp __agg = __mine ? _Cp(__tile_mem[__first]) : _Cp();
+          for (std::size_t __j = 1; __j < __mine; ++__j) {
+            __agg = __op(__agg, _Cp(__tile_mem[__first + __j]));
+            __tile_mem[__first + __j] = __agg;
+          }
+          __item_mem[__lid] = __agg;
+          sycl::group_barrier(__g);
+
+          // Scan of the per-item aggregates. Items without elements come
+          // last, so their values never reach an item that has elements.
+          for (std::size_t __d = 1; __d < __wg; __d *= 2) {
+            const _Cp __y = __lid >= __d ? _Cp(__item_mem[__lid - __d]) : _Cp();
+            sycl::group_barrier(__g);
+            if (__lid >= __d)
+              __item_mem[__lid] = __op(__y, _Cp(__item_mem[__lid]));
+            sycl::group_barrier(__g);
+          }
+
+          // Look-back. __prefix_mem receives the prefix of everything before
+          // this tile, which exists unless this is the first tile of an
+          // inclusive scan.
+          const bool __has_prefix = __exclusive || __t > 0;
+          if (__lid == 0) {
+            const _Cp __tile_agg = __item_mem[(__count - 1) / __k];
+            _Cp __prefix = __init;
+            if (__t > 0) {
+              __aggregates[__t] = __tile_agg;
+              _Flag(__flags[__t])
+                  .store(__scan_aggregate, sycl::memory_order::release);
+              bool __have = false;
+              for (std::size_t __p = __t - 1;; --__p) {
+                int __s;
+                while ((__s = _Flag(__flags[__p])
+                                  .load(sycl::memory_order::acquire)) ==
+                       __scan_invalid) {
+                }
+                const _Cp __v =
+                    __s == __scan_prefix ? __prefixes[__p] : __aggregates[__p];
+                __prefix = __have ? __op(__v, __prefix) : __v;
+                __have = true;
+                if (__s == __scan_prefix)
+                  break;
+              }
+            }
+            __prefixes[__t] =
+                __has_prefix ? __op(__prefix, __tile_agg) : __tile_agg;
+            _Flag(__flags[__t])
+                .store(__scan_prefix, sycl::memory_order::release);
+            __prefix_mem[0] = __prefix;
+          }
+          sycl::group_barrier(__g);
+
+          // Prefix of this work-item's first element.
+          bool __has = __has_prefix;
+          _Cp __run = __has ? _Cp(__prefix_mem[0]) : _Cp();
+          if (__lid > 0 && __mine) {
+            const _Cp __before = __item_mem[__lid - 1];
+            __run = __has ? __op(__run, __before) : __before;
+            __has = true;
+          }
+          if (__exclusive) {
+            // Downwards, so each element still reads its predecessor's
+            // partial result.
+            for (std::size_t __j = __mine; __j-- > 0;)
+              __tile_mem[__first + __j] =
+                  __j ? __op(__run, _Cp(__tile_mem[__first + __j - 1])) : __run;
+          } else if (__has) {
+            for (std::size_t __j = 0; __j < __mine; ++__j)
+              __tile_mem[__first + __j] =
+                  __op(__run, _Cp(__tile_mem[__first + __j]));
+          }
+          sycl::group_barrier(__g);
+
+          for (std::size_t __i = __lid; __i < __count; __i += __wg)
+            __out[__base + __i] = __tile_mem[__i];
+        });
+  });
+
+  // Release the tile state once the scan is done.
+  return __free_after(__q, __e, __flags, __states);
+}
+
+template <class _Tp, class _BinaryOp>
+sycl::event inclusive_scan(sycl::queue &__q, const complex<_Tp> *__in,
+                           complex<_Tp> *__out, std::size_t __n,
+                           _BinaryOp __op,
+                           const std::vector<sycl::event> &__deps = {}) {
+  return __device_scan(__q, __in, __out, __n, __op, false, complex<_Tp>(),
+                       __deps);
+}
+
+template <class _Tp, class _BinaryOp>
+sycl::event exclusive_scan(sycl::queue &__q, const complex<_Tp> *__in,
+                           complex<_Tp> *__out, std::size_t __n,
+                           complex<_Tp> __init, _BinaryOp __op,
+                           const std::vector<sycl::event> &__deps = {}) {
+  return __device_scan(__q, __in, __out, __n, __op, true, __init, __deps);
+}
+
+_SYCL_EXT_CPLX_END_NAMESPACE_STD
+
+#undef _SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD
+#undef _SYCL_EXT_CPLX_END_NAMESPACE_STD
+#undef _SYCL_EXT_CPLX_INLINE_VISIBILITY
+
+#endif // _SYCL_EXT_CPLX_COMPLEX_ALGORITHM
@@ -0,0 +1,143 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the SyclCPLX project, under the Apache License v2.0 with LLVM
+// Exceptions. See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _SYCL_EXT_CPLX_COMPLEX_ATOMIC
+#define _SYCL_EXT_CPLX_COMPLEX_ATOMIC
+
+// clang-format off
+
+/*
+    atomic synopsis
+
+namespace sycl::ext::cplx
+{
+
+// dst += v, updating the real and imaginary parts with two independent
+// atomic additions (T is float or double). Concurrent additions are never
+// lost, but another work-item may observe one part updated before the other.
+// complex<double> needs a device with aspect::atomic64.
+template<sycl::memory_order Order = sycl::memory_order::relaxed,
+         sycl::memory_scope Scope = sycl::memory_scope::device,
+         sycl::access::address_space Space = sycl::access::address_space::generic_space,
+         class T>
+  void atomic_add(complex<T>& dst, complex<T> v);
+
+// dst += v for complex<float>, updating both parts together with one 64-bit
+// compare-and-swap loop, and returning the previous value of dst. dst must be
+// 8-byte aligned, which every element of a USM allocation or buffer is.
+// Needs a device with aspect::atomic64.
+template<sycl::memory_order Order = sycl::memory_order::relaxed,
+         sycl::memory_scope Scope = sycl::memory_scope::device,
+         sycl::access::address_space Space = sycl::access::address_space::generic_space>
+  complex<float> atomic_fetch_add(complex<float>& dst, complex<float> v);
+
+// dst[index[i]] += values[i] for i in [0, n), with atomic_add. Throws
+// sycl::exception with errc::feature_not_supported for complex<double> if the
+// queue's device lacks aspect::atomic64.
+template<class T, class Index>
+  sycl::event scatter_add(sycl::queue&, const complex<T>* values,
+                          const Index* index, size_t n, complex<T>* dst,
+                          const std::vector<sycl::event>& deps = {});
+
+}  // sycl::ext::cplx
+
+*/
+
+// clang-format on
+
+#include "sycl_ext_complex.hpp"
+#include "sycl_ext_complex_algorithm.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#define _SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD namespace sycl::ext::cplx {
+#define _SYCL_EXT_CPLX_END_NAMESPACE_STD }
+#define _SYCL_EXT_CPLX_INLINE_VISIBILITY                                       \
+  inline __attribute__((__visibility__("hidden"), __always_inline__))
+
+_SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD
+
+// atomic_add
+
+template <sycl::memory_order _Order = sycl::memory_order::relaxed,
+          sycl::memory_scope _Scope = sycl::memory_scope::device,
+          sycl::access::address_space _Space =
+              sycl::access::address_space::generic_space,
+          class _Tp>
+SYCL_EXTERNAL _SYCL_EXT_CPLX_INLINE_VISIBILITY void
+atomic_add(complex<_Tp> &__dst, complex<_Tp> __v) {
+  static_assert(std::is_same_v<_Tp, float> || std::is_same_v<_Tp, double>,
+                "atomic_add requires complex<float> or complex<double>");
+  // complex<T> is laid out as the real part followed by the imaginary part.
+  _Tp *__parts = reinterpret_cast<_Tp *>(&__dst);
+  sycl::atomic_ref<_Tp, _Order, _Scope, _Space>(__parts[0])
+      .fetch_add(__v.real());
+  sycl::atomic_ref<_Tp, _Order, _Scope, _Space>(__parts[1])
+      .fetch_add(__v.imag());
+}
+
+// Host-side check that atomic_add on complex<_Tp> can run on __d.
+template <class _Tp> void __check_atomic_add(const sycl::device &__d) {
+  if (std::is_same_v<_Tp, double> && !__d.has(sycl::aspect::atomic64))
+    throw sycl::exception(
+        sycl::make_error_code(sycl::errc::feature_not_supported),
+        "atomic_add on complex<double> needs aspect::atomic64");
+}
+
+// atomic_fetch_add
+
+template <sycl::memory_order _Order = sycl::memory_order::relaxed,
+          sycl::memory_scope _Scope = sycl::memory_scope::device,
+          sycl::access::address_space _Space =
+              sycl::access::address_space::generic_space>
+SYCL_EXTERNAL _SYCL_EXT_CPLX_INLINE_VISIBILITY complex<float>
+atomic_fetch_add(complex<float> &__dst, complex<float> __v) {
+  static_assert(sizeof(complex<float>) == sizeof(std::uint64_t),
+                "complex<float> must pack into 64 bits");
+  sycl::atomic_ref<std::uint64_t, _Order, _Scope, _Space> __ref(
+      *reinterpret_cast<std::uint64_t *>(&__dst));
+  std::uint64_t __old = __ref.load();
+  complex<float> __prev;
+  do {
+    __prev = sycl::bit_cast<complex<float>>(__old);
+  } while (!__ref.compare_exchange_weak(
+      __old, sycl::bit_cast<std::uint64_t>(__prev + __v)));
+  return __prev;
+}
+
+// scatter_add
+
+template <class _Tp, class _Index>
+sycl::event scatter_add(sycl::queue &__q, const complex<_Tp> *__values,
+                        const _Index *__index, std::size_t __n,
+                        complex<_Tp> *__dst,
+                        const std::vector<sycl::event> &__deps = {}) {
+  static_assert(std::is_integral_v<_Index>, "scatter_add index is integral");
+  __check_atomic_add<_Tp>(__q.get_device());
+  const __launch_config __cfg = __elementwise_config(__q.get_device(), __n);
+  return __q.submit([&](sycl::handler &__cgh) {
+    __cgh.depends_on(__deps);
+    __cgh.parallel_for(__cfg.__range(), [=](sycl::nd_item<1> __it) {
+      const std::size_t __stride = __it.get_global_range(0);
+      for (std::size_t __i = __it.get_global_id(0); __i < __n; __i += __stride)
+        atomic_add(__dst[__index[__i]], __values[__i]);
+    });
+  });
+}
+
+_SYCL_EXT_CPLX_END_NAMESPACE_STD
+
+#undef _SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD
+#undef _SYCL_EXT_CPLX_END_NAMESPACE_STD
+#undef _SYCL_EXT_CPLX_INLINE_VISIBILITY
+
+#endif // _SYCL_EXT_CPLX_COMPLEX_ATOMIC
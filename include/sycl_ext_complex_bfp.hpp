@@ -0,0 +1,325 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the SyclCPLX project, under the Apache License v2.0 with LLVM
+// Exceptions. See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _SYCL_EXT_CPLX_COMPLEX_BFP
+#define _SYCL_EXT_CPLX_COMPLEX_BFP
+
+// clang-format off
+
+/*
+    bfp_complex_view synopsis
+
+namespace sycl::ext::cplx
+{
+
+// Block-floating-point storage of complex<T> values. Every block of Block
+// consecutive elements shares one int8_t exponent e and stores each element
+// as a fixed_complex<Mant> mantissa m, the element value being m * 2^e.
+// The exponent is chosen from the largest component magnitude in the block,
+// so each component is stored with an absolute error of at most
+// max|component| * 2^-digits(Mant). The exponent is clamped to [-128, 127],
+// so this holds for blocks whose largest component magnitude lies in
+// [2^-129, 2^127): larger blocks saturate and smaller ones are stored with an
+// absolute error of at most 2^(-128 - digits(Mant)). Non-finite inputs are
+// not representable: NaN components are stored as zero and infinities
+// saturate.
+//
+// The view does not own its memory: it refers to exponent_count(n) exponents
+// and n mantissas allocated by the caller. It is trivially copyable and can
+// be captured by value in kernels.
+
+template<class T, class Mant = int8_t, size_t Block = 32>
+class bfp_complex_view
+{
+public:
+    typedef complex<T>          value_type;
+    typedef fixed_complex<Mant> mantissa_type;
+    typedef int8_t              exponent_type;
+    static constexpr size_t block_size = Block;
+
+    static constexpr size_t exponent_count(size_t n);
+    static constexpr size_t storage_bytes(size_t n);
+
+    bfp_complex_view();
+    bfp_complex_view(mantissa_type* mantissas, exponent_type* exponents, size_t n);
+
+    size_t size() const;
+    mantissa_type* mantissas() const;
+    exponent_type* exponents() const;
+
+    value_type operator[](size_t i) const;     // decompresses one element
+
+    class const_iterator;                      // random access, decompresses on the fly
+    const_iterator begin() const;
+    const_iterator end() const;
+};
+
+template<class T, class Mant, size_t Block>
+  sycl::event bfp_compress(sycl::queue&, const complex<T>* in,
+                           bfp_complex_view<T, Mant, Block> out,
+                           const std::vector<sycl::event>& deps = {});
+template<class T, class Mant, size_t Block>
+  sycl::event bfp_decompress(sycl::queue&, bfp_complex_view<T, Mant, Block> in,
+                             complex<T>* out,
+                             const std::vector<sycl::event>& deps = {});
+
+}  // sycl::ext::cplx
+
+*/
+
+// clang-format on
+
+#include "sycl_ext_complex.hpp"
+#include "sycl_ext_complex_fixed.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+#define _SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD namespace sycl::ext::cplx {
+#define _SYCL_EXT_CPLX_END_NAMESPACE_STD }
+#define _SYCL_EXT_CPLX_INLINE_VISIBILITY                                       \
+  inline __attribute__((__visibility__("hidden"), __always_inline__))
+
+_SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD
+
+template <class _View> class __bfp_const_iterator;
+
+template <class _Tp, class _Mant = std::int8_t, std::size_t _Block = 32>
+class bfp_complex_view {
+  static_assert(is_genfloat<_Tp>::value,
+                "bfp_complex_view requires a half, float or double value");
+  static_assert(_Block > 0 && _Block <= 1024,
+                "bfp_complex_view block must fit in one work-group");
+
+public:
+  typedef complex<_Tp> value_type;
+  typedef fixed_complex<_Mant> mantissa_type;
+  typedef std::int8_t exponent_type;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  static constexpr size_type block_size = _Block;
+
+private:
+  mantissa_type *__mant_;
+  exponent_type *__exp_;
+  size_type __n_;
+
+public:
+  static constexpr size_type exponent_count(size_type __n) {
+    return (__n + _Block - 1) / _Block;
+  }
+  static constexpr size_type storage_bytes(size_type __n) {
+    return __n * sizeof(mantissa_type) +
+           exponent_count(__n) * sizeof(exponent_type);
+  }
+
+  // Exponent for a block whose largest component magnitude is __m, such that
+  // every mantissa lies in [-1, 1) before quantization, clamped to the range
+  // of exponent_type.
+  static _SYCL_EXT_CPLX_INLINE_VISIBILITY exponent_type
+  block_exponent(_Tp __m) {
+    constexpr int __lo = std::numeric_limits<exponent_type>::min();
+    constexpr int __hi = std::numeric_limits<exponent_type>::max();
+    if (!(__m > _Tp(0)))
+      return exponent_type(__lo);
+    if (sycl::isinf(__m))
+      return exponent_type(__hi);
+    int __e = sycl::ilogb(__m) + 1;
+    return exponent_type(__e < __lo ? __lo : (__e > __hi ? __hi : __e));
+  }
+
+  typedef __bfp_const_iterator<bfp_complex_view> const_iterator;
+
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY constexpr bfp_complex_view()
+      : __mant_(nullptr), __exp_(nullptr), __n_(0) {}
+  bfp_complex_view(mantissa_type *__mantissas, exponent_type *__exponents,
+                   size_type __n)
+      : __mant_(__mantissas), __exp_(__exponents), __n_(__n) {}
+
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY size_type size() const { return __n_; }
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY mantissa_type *mantissas() const {
+    return __mant_;
+  }
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY exponent_type *exponents() const {
+    return __exp_;
+  }
+
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY value_type
+  operator[](size_type __i) const {
+    // One shift combines the block exponent with the Q-format scale.
+    const int __e = int(__exp_[__i / _Block]) - mantissa_type::frac_bits;
+    const mantissa_type __m = __mant_[__i];
+    return value_type(sycl::ldexp(_Tp(__m.real()), __e),
+                      sycl::ldexp(_Tp(__m.imag()), __e));
+  }
+
+  // Quantizes __v against block exponent __e.
+  static _SYCL_EXT_CPLX_INLINE_VISIBILITY mantissa_type
+  quantize(const value_type &__v, exponent_type __e) {
+    return mantissa_type(value_type(sycl::ldexp(__v.real(), -int(__e)),
+                                    sycl::ldexp(__v.imag(), -int(__e))));
+  }
+
+  const_iterator begin() const { return const_iterator(*this, 0); }
+  const_iterator end() const { return const_iterator(*this, __n_); }
+};
+
+// Random access iterator that decompresses each element as it is read.
+template <class _View> class __bfp_const_iterator {
+  _View __v_;
+  typename _View::size_type __i_;
+
+public:
+  typedef std::random_access_iterator_tag iterator_category;
+  typedef typename _View::value_type value_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef void pointer;
+  typedef typename _View::value_type reference;
+
+  __bfp_const_iterator() : __v_(), __i_(0) {}
+  __bfp_const_iterator(const _View &__v, typename _View::size_type __i)
+      : __v_(__v), __i_(__i) {}
+
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY reference operator*() const {
+    return __v_[__i_];
+  }
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY reference
+  operator[](difference_type __d) const {
+    return __v_[__i_ + __d];
+  }
+
+  __bfp_const_iterator &operator++() {
+    ++__i_;
+    return *this;
+  }
+  __bfp_const_iterator operator++(int) {
+    __bfp_const_iterator __t(*this);
+    ++__i_;
+    return __t;
+  }
+  __bfp_const_iterator &operator--() {
+    --__i_;
+    return *this;
+  }
+  __bfp_const_iterator operator--(int) {
+    __bfp_const_iterator __t(*this);
+    --__i_;
+    return __t;
+  }
+  __bfp_const_iterator &operator+=(difference_type __d) {
+    __i_ += __d;
+    return *this;
+  }
+  __bfp_const_iterator &operator-=(difference_type __d) {
+    __i_ -= __d;
+    return *this;
+  }
+  friend __bfp_const_iterator operator+(__bfp_const_iterator __it,
+                                        difference_type __d) {
+    return __it += __d;
+  }
+  friend __bfp_const_iterator operator+(difference_type __d,
+                                        __bfp_const_iterator __it) {
+    return __it += __d;
+  }
+  friend __bfp_const_iterator operator-(__bfp_const_iterator __it,
+                                        difference_type __d) {
+    return __it -= __d;
+  }
+  friend difference_type operator-(const __bfp_const_iterator &__x,
+                                   const __bfp_const_iterator &__y) {
+    return difference_type(__x.__i_) - difference_type(__y.__i_);
+  }
+  friend bool operator==(const __bfp_const_iterator &__x,
+                         const __bfp_const_iterator &__y) {
+    return __x.__i_ == __y.__i_;
+  }
+  friend bool operator!=(const __bfp_const_iterator &__x,
+                         const __bfp_const_iterator &__y) {
+    return __x.__i_ != __y.__i_;
+  }
+  friend bool operator<(const __bfp_const_iterator &__x,
+                        const __bfp_const_iterator &__y) {
+    return __x.__i_ < __y.__i_;
+  }
+  friend bool operator>(const __bfp_const_iterator &__x,
+                        const __bfp_const_iterator &__y) {
+    return __y < __x;
+  }
+  friend bool operator<=(const __bfp_const_iterator &__x,
+                         const __bfp_const_iterator &__y) {
+    return !(__y < __x);
+  }
+  friend bool operator>=(const __bfp_const_iterator &__x,
+                         const __bfp_const_iterator &__y) {
+    return !(__x < __y);
+  }
+};
+
+// bfp_compress, one work-group per block. Blocks larger than the device's
+// maximum work-group size are covered by each work-item taking several
+// elements.
+
+template <class _Tp, class _Mant, std::size_t _Block>
+sycl::event bfp_compress(sycl::queue &__q, const complex<_Tp> *__in,
+                         bfp_complex_view<_Tp, _Mant, _Block> __out,
+                         const std::vector<sycl::event> &__deps = {}) {
+  typedef bfp_complex_view<_Tp, _Mant, _Block> _View;
+  const std::size_t __n = __out.size();
+  const std::size_t __blocks = _View::exponent_count(__n);
+  const std::size_t __wg = std::min<std::size_t>(
+      _Block,
+      __q.get_device().get_info<sycl::info::device::max_work_group_size>());
+  return __q.submit([&](sycl::handler &__cgh) {
+    __cgh.depends_on(__deps);
+    __cgh.parallel_for(
+        sycl::nd_range<1>(__blocks * __wg, __wg), [=](sycl::nd_item<1> __it) {
+          const std::size_t __first = __it.get_group(0) * _Block;
+          const std::size_t __last = std::min(__first + _Block, __n);
+          _Tp __m = 0;
+          for (std::size_t __i = __first + __it.get_local_id(0); __i < __last;
+               __i += __wg)
+            __m = sycl::fmax(__m, sycl::fmax(sycl::fabs(__in[__i].real()),
+                                             sycl::fabs(__in[__i].imag())));
+          __m = sycl::reduce_over_group(__it.get_group(), __m,
+                                        sycl::maximum<_Tp>());
+          const auto __e = _View::block_exponent(__m);
+          if (__it.get_local_id(0) == 0)
+            __out.exponents()[__it.get_group(0)] = __e;
+          for (std::size_t __i = __first + __it.get_local_id(0); __i < __last;
+               __i += __wg)
+            __out.mantissas()[__i] = _View::quantize(__in[__i], __e);
+        });
+  });
+}
+
+// bfp_decompress
+
+template <class _Tp, class _Mant, std::size_t _Block>
+sycl::event bfp_decompress(sycl::queue &__q,
+                           bfp_complex_view<_Tp, _Mant, _Block> __in,
+                           complex<_Tp> *__out,
+                           const std::vector<sycl::event> &__deps = {}) {
+  return __q.submit([&](sycl::handler &__cgh) {
+    __cgh.depends_on(__deps);
+    __cgh.parallel_for(sycl::range<1>(__in.size()),
+                       [=](sycl::id<1> __i) { __out[__i] = __in[__i]; });
+  });
+}
+
+_SYCL_EXT_CPLX_END_NAMESPACE_STD
+
+#undef _SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD
+#undef _SYCL_EXT_CPLX_END_NAMESPACE_STD
+#undef _SYCL_EXT_CPLX_INLINE_VISIBILITY
+
+#endif // _SYCL_EXT_CPLX_COMPLEX_BFP
@@ -0,0 +1,731 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the SyclCPLX project, under the Apache License v2.0 with LLVM
+// Exceptions. See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _SYCL_EXT_CPLX_COMPLEX_BLAS
+#define _SYCL_EXT_CPLX_COMPLEX_BLAS
+
+// clang-format off
+
+/*
+    blas synopsis
+
+namespace sycl::ext::cplx
+{
+
+// Level-1 BLAS over complex<T> USM vectors (T is half, float or double).
+// Vectors are described BLAS style by a length n, a pointer x and an
+// increment incx; a negative increment walks the vector from its end, so
+// element i is x[(n - 1 - i) * -incx]. Results are written to USM memory.
+
+// result = sqrt(sum |x[i]|^2), without overflow or underflow in the sum.
+// incx must be positive; result is 0 otherwise.
+template<class T>
+  sycl::event nrm2(sycl::queue&, size_t n, const complex<T>* x,
+                   ptrdiff_t incx, T* result,
+                   const std::vector<sycl::event>& deps = {});
+
+// result = sum x[i] * y[i] (dotu) or sum conj(x[i]) * y[i] (dotc), with the
+// products accumulated by FMA in Acc, which defaults to T (float for half).
+// The products skip the NaN recovery of operator*.
+template<class Acc = void, class T>
+  sycl::event dotu(sycl::queue&, size_t n, const complex<T>* x, ptrdiff_t incx,
+                   const complex<T>* y, ptrdiff_t incy, complex<T>* result,
+                   const std::vector<sycl::event>& deps = {});
+template<class Acc = void, class T>
+  sycl::event dotc(sycl::queue&, size_t n, const complex<T>* x, ptrdiff_t incx,
+                   const complex<T>* y, ptrdiff_t incy, complex<T>* result,
+                   const std::vector<sycl::event>& deps = {});
+
+// Elementwise routines, one pass over memory each. Scalars are converted to
+// the vector type. Products skip the NaN recovery of operator*.
+
+// y = alpha * x + y
+template<class T>
+  sycl::event axpy(sycl::queue&, size_t n, complex<T> alpha,
+                   const complex<T>* x, ptrdiff_t incx, complex<T>* y,
+                   ptrdiff_t incy, const std::vector<sycl::event>& deps = {});
+// y = alpha * x + beta * y, and w = alpha * x + beta * y. y is not read
+// when beta is 0.
+template<class T>
+  sycl::event axpby(sycl::queue&, size_t n, complex<T> alpha,
+                    const complex<T>* x, ptrdiff_t incx, complex<T> beta,
+                    complex<T>* y, ptrdiff_t incy,
+                    const std::vector<sycl::event>& deps = {});
+template<class T>
+  sycl::event waxpby(sycl::queue&, size_t n, complex<T> alpha,
+                     const complex<T>* x, ptrdiff_t incx, complex<T> beta,
+                     const complex<T>* y, ptrdiff_t incy, complex<T>* w,
+                     ptrdiff_t incw, const std::vector<sycl::event>& deps = {});
+// x = alpha * x
+template<class T>
+  sycl::event scal(sycl::queue&, size_t n, complex<T> alpha, complex<T>* x,
+                   ptrdiff_t incx, const std::vector<sycl::event>& deps = {});
+template<class T>
+  sycl::event scal(sycl::queue&, size_t n, T alpha, complex<T>* x,
+                   ptrdiff_t incx, const std::vector<sycl::event>& deps = {});
+// y = x, and y = conj(x)
+template<class T>
+  sycl::event copy(sycl::queue&, size_t n, const complex<T>* x, ptrdiff_t incx,
+                   complex<T>* y, ptrdiff_t incy,
+                   const std::vector<sycl::event>& deps = {});
+template<class T>
+  sycl::event copy_conj(sycl::queue&, size_t n, const complex<T>* x,
+                        ptrdiff_t incx, complex<T>* y, ptrdiff_t incy,
+                        const std::vector<sycl::event>& deps = {});
+// x <-> y
+template<class T>
+  sycl::event swap(sycl::queue&, size_t n, complex<T>* x, ptrdiff_t incx,
+                   complex<T>* y, ptrdiff_t incy,
+                   const std::vector<sycl::event>& deps = {});
+// Plane rotation: x = c * x + s * y, y = c * y - conj(s) * x
+template<class T>
+  sycl::event rot(sycl::queue&, size_t n, complex<T>* x, ptrdiff_t incx,
+                  complex<T>* y, ptrdiff_t incy, T c, complex<T> s,
+                  const std::vector<sycl::event>& deps = {});
+template<class T>
+  sycl::event rot(sycl::queue&, size_t n, complex<T>* x, ptrdiff_t incx,
+                  complex<T>* y, ptrdiff_t incy, T c, T s,
+                  const std::vector<sycl::event>& deps = {});
+
+// Level-2 and level-3 matrices are described by a layout, a leading
+// dimension and an operation applied to the matrix as stored.
+enum class layout { row_major, col_major };
+enum class transpose { nontrans, trans, conjtrans };
+
+// y = alpha * op(A) * x + beta * y, where A is m x n. y is not read when
+// beta is 0.
+template<class T>
+  sycl::event gemv(sycl::queue&, layout, transpose trans, size_t m, size_t n,
+                   complex<T> alpha, const complex<T>* a, size_t lda,
+                   const complex<T>* x, ptrdiff_t incx, complex<T> beta,
+                   complex<T>* y, ptrdiff_t incy,
+                   const std::vector<sycl::event>& deps = {});
+
+}  // sycl::ext::cplx
+
+*/
+
+// clang-format on
+
+#include "sycl_ext_complex.hpp"
+#include "sycl_ext_complex_algorithm.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#define _SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD namespace sycl::ext::cplx {
+#define _SYCL_EXT_CPLX_END_NAMESPACE_STD }
+#define _SYCL_EXT_CPLX_INLINE_VISIBILITY                                       \
+  inline __attribute__((__visibility__("hidden"), __always_inline__))
+
+_SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD
+
+// Type used to accumulate reductions over complex<_Tp>. half has too little
+// range and precision for long sums, so it accumulates in float.
+template <class _Tp> struct __blas_accumulator { typedef _Tp type; };
+template <> struct __blas_accumulator<sycl::half> { typedef float type; };
+
+// Offset of element __i of a BLAS vector of length __n and increment __inc.
+_SYCL_EXT_CPLX_INLINE_VISIBILITY std::ptrdiff_t
+__blas_offset(std::size_t __i, std::size_t __n, std::ptrdiff_t __inc) {
+  return __inc >= 0 ? std::ptrdiff_t(__i) * __inc
+                    : std::ptrdiff_t(__n - 1 - __i) * -__inc;
+}
+
+// nrm2
+//
+// Blue's algorithm, as in LAPACK's dznrm2: squares of mid-range components
+// are summed directly, and only components too small or too large to square
+// safely are scaled by a power of two into range first. Sums of the three
+// accumulators can be reduced in any order, so each work-item accumulates a
+// triple, each work-group reduces them, and a last kernel combines the
+// work-group partials.
+
+// Exact powers of two and halved exponents for the constants below.
+template <class _Tp> constexpr _Tp __blue_pow2(int __e) {
+  _Tp __r = 1;
+  for (; __e > 0; --__e)
+    __r *= _Tp(2);
+  for (; __e < 0; ++__e)
+    __r /= _Tp(2);
+  return __r;
+}
+constexpr int __blue_floor_half(int __e) {
+  return __e >= 0 ? __e / 2 : -((1 - __e) / 2);
+}
+constexpr int __blue_ceil_half(int __e) { return -__blue_floor_half(-__e); }
+
+// Thresholds between the small, medium and big accumulators, and the
+// factors that scale small and big components into range.
+template <class _Tp> struct __blue_constants {
+  typedef std::numeric_limits<_Tp> _Lim;
+  static_assert(_Lim::radix == 2, "nrm2 assumes a binary floating point type");
+  static constexpr int __emin = _Lim::min_exponent;
+  static constexpr int __emax = _Lim::max_exponent;
+  static constexpr int __digits = _Lim::digits;
+
+  static constexpr _Tp __tsml = __blue_pow2<_Tp>(__blue_ceil_half(__emin - 1));
+  static constexpr _Tp __tbig =
+      __blue_pow2<_Tp>(__blue_floor_half(__emax - __digits + 1));
+  static constexpr _Tp __ssml =
+      __blue_pow2<_Tp>(-__blue_floor_half(__emin - __digits));
+  static constexpr _Tp __sbig =
+      __blue_pow2<_Tp>(-__blue_ceil_half(__emax + __digits - 1));
+};
+
+template <class _Tp> struct __blue_sums {
+  _Tp __sml, __med, __big;
+
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY void __add(_Tp __a) {
+    typedef __blue_constants<_Tp> _Kp;
+    __a = sycl::fabs(__a);
+    if (__a > _Kp::__tbig) {
+      __a *= _Kp::__sbig;
+      __big = sycl::fma(__a, __a, __big);
+    } else if (__a < _Kp::__tsml) {
+      __a *= _Kp::__ssml;
+      __sml = sycl::fma(__a, __a, __sml);
+    } else {
+      // Also taken by NaN, which then propagates through __med.
+      __med = sycl::fma(__a, __a, __med);
+    }
+  }
+
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY _Tp __norm() const {
+    typedef __blue_constants<_Tp> _Kp;
+    if (sycl::isnan(__med))
+      return __med;
+    if (__big > _Tp(0)) {
+      // Mid-range components only matter if they are not negligible.
+      const _Tp __m = __med * _Kp::__sbig;
+      return sycl::sqrt(__big + __m * _Kp::__sbig) / _Kp::__sbig;
+    }
+    if (__sml > _Tp(0)) {
+      const _Tp __s = sycl::sqrt(__sml) / _Kp::__ssml;
+      if (!(__med > _Tp(0)))
+        return __s;
+      const _Tp __m = sycl::sqrt(__med);
+      const _Tp __ymin = sycl::fmin(__s, __m);
+      const _Tp __ymax = sycl::fmax(__s, __m);
+      const _Tp __r = __ymin / __ymax;
+      return __ymax * sycl::sqrt(_Tp(1) + __r * __r);
+    }
+    return sycl::sqrt(__med);
+  }
+};
+
+template <class _Tp>
+sycl::event nrm2(sycl::queue &__q, std::size_t __n, const complex<_Tp> *__x,
+                 std::ptrdiff_t __incx, _Tp *__result,
+                 const std::vector<sycl::event> &__deps = {}) {
+  static_assert(is_genfloat<_Tp>::value, "nrm2 requires half, float or double");
+  typedef typename __blas_accumulator<_Tp>::type _Acc;
+
+  if (__n == 0 || __incx <= 0)
+    return __q.submit([&](sycl::handler &__cgh) {
+      __cgh.depends_on(__deps);
+      __cgh.single_task([=] { *__result = _Tp(0); });
+    });
+
+  const __launch_config __cfg = __elementwise_config(__q.get_device(), __n);
+  const std::size_t __groups = __cfg.__groups;
+  _Acc *__partial = sycl::malloc_device<_Acc>(3 * __groups, __q);
+  if (!__partial)
+    throw std::bad_alloc();
+
+  sycl::event __e = __q.submit([&](sycl::handler &__cgh) {
+    __cgh.depends_on(__deps);
+    __cgh.parallel_for(__cfg.__range(), [=](sycl::nd_item<1> __it) {
+      __blue_sums<_Acc> __s = {_Acc(0), _Acc(0), _Acc(0)};
+      const std::size_t __stride = __it.get_global_range(0);
+      for (std::size_t __i = __it.get_global_id(0); __i < __n;
+           __i += __stride) {
+        const complex<_Tp> __z = __x[__blas_offset(__i, __n, __incx)];
+        __s.__add(_Acc(__z.real()));
+        __s.__add(_Acc(__z.imag()));
+      }
+      const auto __g = __it.get_group();
+      const sycl::plus<_Acc> __plus;
+      __s.__sml = sycl::reduce_over_group(__g, __s.__sml, __plus);
+      __s.__med = sycl::reduce_over_group(__g, __s.__med, __plus);
+      __s.__big = sycl::reduce_over_group(__g, __s.__big, __plus);
+      if (__it.get_local_id(0) == 0) {
+        _Acc *__p = __partial + 3 * __it.get_group(0);
+        __p[0] = __s.__sml;
+        __p[1] = __s.__med;
+        __p[2] = __s.__big;
+      }
+    });
+  });
+
+  __e = __q.submit([&](sycl::handler &__cgh) {
+    __cgh.depends_on(__e);
+    __cgh.single_task([=] {
+      __blue_sums<_Acc> __s = {_Acc(0), _Acc(0), _Acc(0)};
+      for (std::size_t __i = 0; __i < __groups; ++__i) {
+        __s.__sml += __partial[3 * __i];
+        __s.__med += __partial[3 * __i + 1];
+        __s.__big += __partial[3 * __i + 2];
+      }
+      *__result = _Tp(__s.__norm());
+    });
+  });
+
+  return __free_after(__q, __e, __partial);
+}
+
+// dotu, dotc
+//
+// Each work-item accumulates two independent partial sums to keep several
+// FMAs in flight, the sums are reduced within each sub-group, and the
+// sub-group results are combined through local memory into one partial per
+// work-group. A last kernel adds the work-group partials.
+
+template <class _Acc, class _Tp>
+using __blas_accumulator_t =
+    std::conditional_t<std::is_void_v<_Acc>,
+                       typename __blas_accumulator<_Tp>::type, _Acc>;
+
+// (__re, __im) += x * y, or conj(x) * y when _Conj is true.
+template <bool _Conj, class _Acc, class _Tp>
+_SYCL_EXT_CPLX_INLINE_VISIBILITY void
+__fma_dot(const complex<_Tp> &__x, const complex<_Tp> &__y, _Acc &__re,
+          _Acc &__im) {
+  const _Acc __xr = __x.real(), __yr = __y.real(), __yi = __y.imag();
+  const _Acc __xi = _Conj ? -_Acc(__x.imag()) : _Acc(__x.imag());
+  __re = sycl::fma(__xr, __yr, __re);
+  __re = sycl::fma(-__xi, __yi, __re);
+  __im = sycl::fma(__xr, __yi, __im);
+  __im = sycl::fma(__xi, __yr, __im);
+}
+
+template <bool _Conj, class _Acc, class _Tp>
+sycl::event __dot(sycl::queue &__q, std::size_t __n, const complex<_Tp> *__x,
+                  std::ptrdiff_t __incx, const complex<_Tp> *__y,
+                  std::ptrdiff_t __incy, complex<_Tp> *__result,
+                  const std::vector<sycl::event> &__deps) {
+  static_assert(is_genfloat<_Tp>::value, "dot requires half, float or double");
+
+  if (__n == 0)
+    return __q.submit([&](sycl::handler &__cgh) {
+      __cgh.depends_on(__deps);
+      __cgh.single_task([=] { *__result = complex<_Tp>(); });
+    });
+
+  const __launch_config __cfg = __elementwise_config(__q.get_device(), __n);
+  const std::size_t __groups = __cfg.__groups;
+  _Acc *__partial = sycl::malloc_device<_Acc>(2 * __groups, __q);
+  if (!__partial)
+    throw std::bad_alloc();
+
+  sycl::event __e = __q.submit([&](sycl::handler &__cgh) {
+    __cgh.depends_on(__deps);
+    // One (re, im) pair per sub-group; there are at most __wg of them.
+    sycl::local_accessor<_Acc, 1> __sg_sums(sycl::range<1>(2 * __cfg.__wg),
+                                            __cgh);
+    __cgh.parallel_for(__cfg.__range(), [=](sycl::nd_item<1> __it) {
+      const std::size_t __stride = __it.get_global_range(0);
+      _Acc __re0 = 0, __im0 = 0, __re1 = 0, __im1 = 0;
+      std::size_t __i = __it.get_global_id(0);
+      for (; __i + __stride < __n; __i += 2 * __stride) {
+        const std::size_t __j = __i + __stride;
+        __fma_dot<_Conj>(__x[__blas_offset(__i, __n, __incx)],
+                         __y[__blas_offset(__i, __n, __incy)], __re0, __im0);
+        __fma_dot<_Conj>(__x[__blas_offset(__j, __n, __incx)],
+                         __y[__blas_offset(__j, __n, __incy)], __re1, __im1);
+      }
+      if (__i < __n)
+        __fma_dot<_Conj>(__x[__blas_offset(__i, __n, __incx)],
+                         __y[__blas_offset(__i, __n, __incy)], __re0, __im0);
+
+      const auto __sg = __it.get_sub_group();
+      const sycl::plus<_Acc> __plus;
+      const _Acc __re = sycl::reduce_over_group(__sg, __re0 + __re1, __plus);
+      const _Acc __im = sycl::reduce_over_group(__sg, __im0 + __im1, __plus);
+      if (__sg.get_local_linear_id() == 0) {
+        __sg_sums[2 * __sg.get_group_linear_id()] = __re;
+        __sg_sums[2 * __sg.get_group_linear_id() + 1] = __im;
+      }
+      sycl::group_barrier(__it.get_group());
+      if (__it.get_local_id(0) == 0) {
+        _Acc __gre = 0, __gim = 0;
+        for (std::size_t __s = 0; __s < __sg.get_group_linear_range(); ++__s) {
+          __gre += __sg_sums[2 * __s];
+          __gim += __sg_sums[2 * __s + 1];
+        }
+        __partial[2 * __it.get_group(0)] = __gre;
+        __partial[2 * __it.get_group(0) + 1] = __gim;
+      }
+    });
+  });
+
+  __e = __q.submit([&](sycl::handler &__cgh) {
+    __cgh.depends_on(__e);
+    __cgh.single_task([=] {
+      _Acc __re = 0, __im = 0;
+      for (std::size_t __g = 0; __g < __groups; ++__g) {
+        __re += __partial[2 * __g];
+        __im += __partial[2 * __g + 1];
+      }
+      *__result = complex<_Tp>(_Tp(__re), _Tp(__im));
+    });
+  });
+
+  return __free_after(__q, __e, __partial);
+}
+
+template <class _Acc = void, class _Tp>
+sycl::event dotu(sycl::queue &__q, std::size_t __n, const complex<_Tp> *__x,
+                 std::ptrdiff_t __incx, const complex<_Tp> *__y,
+                 std::ptrdiff_t __incy, complex<_Tp> *__result,
+                 const std::vector<sycl::event> &__deps = {}) {
+  return __dot<false, __blas_accumulator_t<_Acc, _Tp>>(
+      __q, __n, __x, __incx, __y, __incy, __result, __deps);
+}
+
+template <class _Acc = void, class _Tp>
+sycl::event dotc(sycl::queue &__q, std::size_t __n, const complex<_Tp> *__x,
+                 std::ptrdiff_t __incx, const complex<_Tp> *__y,
+                 std::ptrdiff_t __incy, complex<_Tp> *__result,
+                 const std::vector<sycl::event> &__deps = {}) {
+  return __dot<true, __blas_accumulator_t<_Acc, _Tp>>(
+      __q, __n, __x, __incx, __y, __incy, __result, __deps);
+}
+
+// Elementwise routines
+
+// Keeps scalar arguments out of template argument deduction, so their type
+// follows the vectors.
+template <class _Tp> struct __blas_scalar { typedef _Tp type; };
+template <class _Tp> using __blas_scalar_t = typename __blas_scalar<_Tp>::type;
+
+// Calls __f(i) for every i in [0, __n) with a grid-stride loop.
+template <class _Fn>
+sycl::event __blas_for_each(sycl::queue &__q, std::size_t __n,
+                            const std::vector<sycl::event> &__deps, _Fn __f) {
+  const __launch_config __cfg = __elementwise_config(__q.get_device(), __n);
+  return __q.submit([&](sycl::handler &__cgh) {
+    __cgh.depends_on(__deps);
+    __cgh.parallel_for(__cfg.__range(), [=](sycl::nd_item<1> __it) {
+      const std::size_t __stride = __it.get_global_range(0);
+      for (std::size_t __i = __it.get_global_id(0); __i < __n; __i += __stride)
+        __f(__i);
+    });
+  });
+}
+
+// alpha * __acc + beta * __y, without reading __y when beta is 0.
+template <class _Tp>
+_SYCL_EXT_CPLX_INLINE_VISIBILITY complex<_Tp>
+__blas_update(const complex<_Tp> &__alpha, const complex<_Tp> &__acc,
+              const complex<_Tp> &__beta, const complex<_Tp> *__y) {
+  complex<_Tp> __r = op::limited_range_multiplies(__alpha, __acc);
+  if (__beta != complex<_Tp>(0, 0))
+    __r += op::limited_range_multiplies(__beta, *__y);
+  return __r;
+}
+
+// axpy
+
+template <class _Tp>
+sycl::event axpy(sycl::queue &__q, std::size_t __n,
+                 __blas_scalar_t<complex<_Tp>> __alpha, const complex<_Tp> *__x,
+                 std::ptrdiff_t __incx, complex<_Tp> *__y,
+                 std::ptrdiff_t __incy,
+                 const std::vector<sycl::event> &__deps = {}) {
+  return __blas_for_each(__q, __n, __deps, [=](std::size_t __i) {
+    complex<_Tp> &__yi = __y[__blas_offset(__i, __n, __incy)];
+    __yi += op::limited_range_multiplies(
+        __alpha, __x[__blas_offset(__i, __n, __incx)]);
+  });
+}
+
+// axpby
+
+template <class _Tp>
+sycl::event axpby(sycl::queue &__q, std::size_t __n,
+                  __blas_scalar_t<complex<_Tp>> __alpha,
+                  const complex<_Tp> *__x, std::ptrdiff_t __incx,
+                  __blas_scalar_t<complex<_Tp>> __beta, complex<_Tp> *__y,
+                  std::ptrdiff_t __incy,
+                  const std::vector<sycl::event> &__deps = {}) {
+  return __blas_for_each(__q, __n, __deps, [=](std::size_t __i) {
+    complex<_Tp> *__yi = __y + __blas_offset(__i, __n, __incy);
+    *__yi = __blas_update(__alpha, __x[__blas_offset(__i, __n, __incx)],
+                          __beta, __yi);
+  });
+}
+
+// waxpby
+
+template <class _Tp>
+sycl::event waxpby(sycl::queue &__q, std::size_t __n,
+                   __blas_scalar_t<complex<_Tp>> __alpha,
+                   const complex<_Tp> *__x, std::ptrdiff_t __incx,
+                   __blas_scalar_t<complex<_Tp>> __beta,
+                   const complex<_Tp> *__y, std::ptrdiff_t __incy,
+                   complex<_Tp> *__w, std::ptrdiff_t __incw,
+                   const std::vector<sycl::event> &__deps = {}) {
+  return __blas_for_each(__q, __n, __deps, [=](std::size_t __i) {
+    __w[__blas_offset(__i, __n, __incw)] = __blas_update(
+        __alpha, __x[__blas_offset(__i, __n, __incx)], __beta,
+        __y + __blas_offset(__i, __n, __incy));
+  });
+}
+
+// scal
+
+template <class _Tp>
+sycl::event scal(sycl::queue &__q, std::size_t __n,
+                 __blas_scalar_t<complex<_Tp>> __alpha, complex<_Tp> *__x,
+                 std::ptrdiff_t __incx,
+                 const std::vector<sycl::event> &__deps = {}) {
+  return __blas_for_each(__q, __n, __deps, [=](std::size_t __i) {
+    complex<_Tp> &__xi = __x[__blas_offset(__i, __n, __incx)];
+    __xi = op::limited_range_multiplies(__alpha, __xi);
+  });
+}
+
+template <class _Tp>
+sycl::event scal(sycl::queue &__q, std::size_t __n,
+                 __blas_scalar_t<_Tp> __alpha, complex<_Tp> *__x,
+                 std::ptrdiff_t __incx,
+                 const std::vector<sycl::event> &__deps = {}) {
+  return __blas_for_each(__q, __n, __deps, [=](std::size_t __i) {
+    complex<_Tp> &__xi = __x[__blas_offset(__i, __n, __incx)];
+    __xi = complex<_Tp>(__alpha * __xi.real(), __alpha * __xi.imag());
+  });
+}
+
+// copy, copy_conj
+
+template <class _Tp>
+sycl::event copy(sycl::queue &__q, std::size_t __n, const complex<_Tp> *__x,
+                 std::ptrdiff_t __incx, complex<_Tp> *__y,
+                 std::ptrdiff_t __incy,
+                 const std::vector<sycl::event> &__deps = {}) {
+  return __blas_for_each(__q, __n, __deps, [=](std::size_t __i) {
+    __y[__blas_offset(__i, __n, __incy)] = __x[__blas_offset(__i, __n, __incx)];
+  });
+}
+
+template <class _Tp>
+sycl::event copy_conj(sycl::queue &__q, std::size_t __n,
+                      const complex<_Tp> *__x, std::ptrdiff_t __incx,
+                      complex<_Tp> *__y, std::ptrdiff_t __incy,
+                      const std::vector<sycl::event> &__deps = {}) {
+  return __blas_for_each(__q, __n, __deps, [=](std::size_t __i) {
+    const complex<_Tp> __xi = __x[__blas_offset(__i, __n, __incx)];
+    __y[__blas_offset(__i, __n, __incy)] =
+        complex<_Tp>(__xi.real(), -__xi.imag());
+  });
+}
+
+// swap
+
+template <class _Tp>
+sycl::event swap(sycl::queue &__q, std::size_t __n, complex<_Tp> *__x,
+                 std::ptrdiff_t __incx, complex<_Tp> *__y,
+                 std::ptrdiff_t __incy,
+                 const std::vector<sycl::event> &__deps = {}) {
+  return __blas_for_each(__q, __n, __deps, [=](std::size_t __i) {
+    complex<_Tp> &__xi = __x[__blas_offset(__i, __n, __incx)];
+    complex<_Tp> &__yi = __y[__blas_offset(__i, __n, __incy)];
+    const complex<_Tp> __t = __xi;
+    __xi = __yi;
+    __yi = __t;
+  });
+}
+
+// rot
+
+template <class _Tp>
+sycl::event rot(sycl::queue &__q, std::size_t __n, complex<_Tp> *__x,
+                std::ptrdiff_t __incx, complex<_Tp> *__y, std::ptrdiff_t __incy,
+                __blas_scalar_t<_Tp> __c, __blas_scalar_t<complex<_Tp>> __s,
+                const std::vector<sycl::event> &__deps = {}) {
+  const complex<_Tp> __sc(__s.real(), -__s.imag());
+  return __blas_for_each(__q, __n, __deps, [=](std::size_t __i) {
+    complex<_Tp> &__xi = __x[__blas_offset(__i, __n, __incx)];
+    complex<_Tp> &__yi = __y[__blas_offset(__i, __n, __incy)];
+    const complex<_Tp> __xv = __xi, __yv = __yi;
+    __xi = complex<_Tp>(__c * __xv.real(), __c * __xv.imag()) +
+           op::limited_range_multiplies(__s, __yv);
+    __yi = complex<_Tp>(__c * __yv.real(), __c * __yv.imag()) -
+           op::limited_range_multiplies(__sc, __xv);
+  });
+}
+
+template <class _Tp>
+sycl::event rot(sycl::queue &__q, std::size_t __n, complex<_Tp> *__x,
+                std::ptrdiff_t __incx, complex<_Tp> *__y, std::ptrdiff_t __incy,
+                __blas_scalar_t<_Tp> __c, __blas_scalar_t<_Tp> __s,
+                const std::vector<sycl::event> &__deps = {}) {
+  return __blas_for_each(__q, __n, __deps, [=](std::size_t __i) {
+    complex<_Tp> &__xi = __x[__blas_offset(__i, __n, __incx)];
+    complex<_Tp> &__yi = __y[__blas_offset(__i, __n, __incy)];
+    const complex<_Tp> __xv = __xi, __yv = __yi;
+    __xi = complex<_Tp>(__c * __xv.real() + __s * __yv.real(),
+                        __c * __xv.imag() + __s * __yv.imag());
+    __yi = complex<_Tp>(__c * __yv.real() - __s * __xv.real(),
+                        __c * __yv.imag() - __s * __xv.imag());
+  });
+}
+
+// gemv
+//
+// Depending on the layout and the operation, either the elements summed into
+// one y[i] are contiguous in memory (the rows of op(A) are) or the elements
+// used by neighbouring y[i] are (the columns of op(A) are), and each case has
+// its own kernel so that A is always read coalesced.
+
+enum class layout { row_major, col_major };
+enum class transpose { nontrans, trans, conjtrans };
+
+// Rows of op(A) contiguous: op(A)(i, j) = a[i * lda + j]. Each work-group
+// computes __gemv_rows_per_group outputs, its work-items striding along the
+// rows together and reusing each x[j] they load for every row.
+constexpr std::size_t __gemv_rows_per_group = 4;
+
+template <bool _Conj, class _Tp>
+sycl::event __gemv_rows(sycl::queue &__q, std::size_t __rows,
+                        std::size_t __cols, complex<_Tp> __alpha,
+                        const complex<_Tp> *__a, std::size_t __lda,
+                        const complex<_Tp> *__x, std::ptrdiff_t __incx,
+                        complex<_Tp> __beta, complex<_Tp> *__y,
+                        std::ptrdiff_t __incy,
+                        const std::vector<sycl::event> &__deps) {
+  typedef typename __blas_accumulator<_Tp>::type _Acc;
+  constexpr std::size_t __r_ = __gemv_rows_per_group;
+  const std::size_t __wg = __elementwise_config(__q.get_device(), __cols).__wg;
+  const std::size_t __groups = (__rows + __r_ - 1) / __r_;
+  return __q.submit([&](sycl::handler &__cgh) {
+    __cgh.depends_on(__deps);
+    __cgh.parallel_for(
+        sycl::nd_range<1>(__groups * __wg, __wg), [=](sycl::nd_item<1> __it) {
+          const std::size_t __r0 = __it.get_group(0) * __r_;
+          _Acc __re[__r_] = {}, __im[__r_] = {};
+          for (std::size_t __j = __it.get_local_id(0); __j < __cols;
+               __j += __wg) {
+            const complex<_Tp> __xj = __x[__blas_offset(__j, __cols, __incx)];
+            for (std::size_t __r = 0; __r < __r_; ++__r)
+              if (__r0 + __r < __rows)
+                __fma_dot<_Conj>(__a[(__r0 + __r) * __lda + __j], __xj,
+                                 __re[__r], __im[__r]);
+          }
+          const auto __g = __it.get_group();
+          for (std::size_t __r = 0; __r < __r_; ++__r) {
+            const _Acc __sr =
+                sycl::reduce_over_group(__g, __re[__r], sycl::plus<_Acc>());
+            const _Acc __si =
+                sycl::reduce_over_group(__g, __im[__r], sycl::plus<_Acc>());
+            if (__it.get_local_id(0) == 0 && __r0 + __r < __rows) {
+              complex<_Tp> *__yi =
+                  __y + __blas_offset(__r0 + __r, __rows, __incy);
+              *__yi = __blas_update(__alpha, complex<_Tp>(_Tp(__sr), _Tp(__si)),
+                                    __beta, __yi);
+            }
+          }
+        });
+  });
+}
+
+// Columns of op(A) contiguous: op(A)(i, j) = a[i + j * lda]. Each work-item
+// computes one output, and the work-group stages x through local memory one
+// tile at a time so every x[j] is loaded from global memory once per group.
+template <bool _Conj, class _Tp>
+sycl::event __gemv_cols(sycl::queue &__q, std::size_t __rows,
+                        std::size_t __cols, complex<_Tp> __alpha,
+                        const complex<_Tp> *__a, std::size_t __lda,
+                        const complex<_Tp> *__x, std::ptrdiff_t __incx,
+                        complex<_Tp> __beta, complex<_Tp> *__y,
+                        std::ptrdiff_t __incy,
+                        const std::vector<sycl::event> &__deps) {
+  typedef typename __blas_accumulator<_Tp>::type _Acc;
+  const std::size_t __wg = __elementwise_config(__q.get_device(), __rows).__wg;
+  const std::size_t __groups = (__rows + __wg - 1) / __wg;
+  return __q.submit([&](sycl::handler &__cgh) {
+    __cgh.depends_on(__deps);
+    sycl::local_accessor<complex<_Tp>, 1> __xt(sycl::range<1>(__wg), __cgh);
+    __cgh.parallel_for(
+        sycl::nd_range<1>(__groups * __wg, __wg), [=](sycl::nd_item<1> __it) {
+          const std::size_t __lid = __it.get_local_id(0);
+          const std::size_t __i = __it.get_global_id(0);
+          _Acc __re = 0, __im = 0;
+          for (std::size_t __j0 = 0; __j0 < __cols; __j0 += __wg) {
+            const std::size_t __tile = sycl::min(__wg, __cols - __j0);
+            if (__lid < __tile)
+              __xt[__lid] = __x[__blas_offset(__j0 + __lid, __cols, __incx)];
+            sycl::group_barrier(__it.get_group());
+            if (__i < __rows)
+              for (std::size_t __jj = 0; __jj < __tile; ++__jj)
+                __fma_dot<_Conj>(__a[__i + (__j0 + __jj) * __lda],
+                                 complex<_Tp>(__xt[__jj]), __re, __im);
+            sycl::group_barrier(__it.get_group());
+          }
+          if (__i < __rows) {
+            complex<_Tp> *__yi = __y + __blas_offset(__i, __rows, __incy);
+            *__yi = __blas_update(__alpha, complex<_Tp>(_Tp(__re), _Tp(__im)),
+                                  __beta, __yi);
+          }
+        });
+  });
+}
+
+template <bool _Conj, class _Tp>
+sycl::event __gemv(sycl::queue &__q, bool __rows_contiguous,
+                   std::size_t __rows, std::size_t __cols,
+                   complex<_Tp> __alpha, const complex<_Tp> *__a,
+                   std::size_t __lda, const complex<_Tp> *__x,
+                   std::ptrdiff_t __incx, complex<_Tp> __beta,
+                   complex<_Tp> *__y, std::ptrdiff_t __incy,
+                   const std::vector<sycl::event> &__deps) {
+  return __rows_contiguous
+             ? __gemv_rows<_Conj>(__q, __rows, __cols, __alpha, __a, __lda,
+                                  __x, __incx, __beta, __y, __incy, __deps)
+             : __gemv_cols<_Conj>(__q, __rows, __cols, __alpha, __a, __lda,
+                                  __x, __incx, __beta, __y, __incy, __deps);
+}
+
+template <class _Tp>
+sycl::event gemv(sycl::queue &__q, layout __layout, transpose __trans,
+                 std::size_t __m, std::size_t __n,
+                 __blas_scalar_t<complex<_Tp>> __alpha, const complex<_Tp> *__a,
+                 std::size_t __lda, const complex<_Tp> *__x,
+                 std::ptrdiff_t __incx, __blas_scalar_t<complex<_Tp>> __beta,
+                 complex<_Tp> *__y, std::ptrdiff_t __incy,
+                 const std::vector<sycl::event> &__deps = {}) {
+  static_assert(is_genfloat<_Tp>::value, "gemv requires half, float or double");
+  const bool __nontrans = __trans == transpose::nontrans;
+  // op(A) is __rows x __cols
+  const std::size_t __rows = __nontrans ? __m : __n;
+  const std::size_t __cols = __nontrans ? __n : __m;
+  if (__rows == 0)
+    return __q.submit([&](sycl::handler &__cgh) {
+      __cgh.depends_on(__deps);
+      __cgh.single_task([=] {});
+    });
+  const bool __rows_contiguous = __nontrans == (__layout == layout::row_major);
+  if (__trans == transpose::conjtrans)
+    return __gemv<true>(__q, __rows_contiguous, __rows, __cols, __alpha, __a,
+                        __lda, __x, __incx, __beta, __y, __incy, __deps);
+  return __gemv<false>(__q, __rows_contiguous, __rows, __cols, __alpha, __a,
+                       __lda, __x, __incx, __beta, __y, __incy, __deps);
+}
+
+_SYCL_EXT_CPLX_END_NAMESPACE_STD
+
+#undef _SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD
+#undef _SYCL_EXT_CPLX_END_NAMESPACE_STD
+#undef _SYCL_EXT_CPLX_INLINE_VISIBILITY
+
+#endif // _SYCL_EXT_CPLX_COMPLEX_BLAS
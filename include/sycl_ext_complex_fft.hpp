@@ -0,0 +1,858 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the SyclCPLX project, under the Apache License v2.0 with LLVM
+// Exceptions. See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _SYCL_EXT_CPLX_COMPLEX_FFT
+#define _SYCL_EXT_CPLX_COMPLEX_FFT
+
+// clang-format off
+
+/*
+    fft synopsis
+
+namespace sycl::ext::cplx
+{
+
+enum class fft_direction { forward, backward };
+
+// out[b * n + k] = scale * sum_j in[b * n + j] * exp(-+2 pi i j k / n) for
+// each of batch contiguous transforms of length n (T is float or double),
+// with the minus sign forward. n must factor into 2, 3, 5 and 7. in and out
+// may be the same array. Throws std::invalid_argument for other lengths.
+template<class T>
+  sycl::event fft(sycl::queue&, fft_direction dir, size_t n, size_t batch,
+                  const complex<T>* in, complex<T>* out, T scale = 1,
+                  const std::vector<sycl::event>& deps = {});
+
+// Two- and three-dimensional transforms of a row-major array, element
+// (i, j) at in[i * cols + j] and (i, j, l) at in[(i * n1 + j) * n2 + l].
+// Every extent must factor into 2, 3, 5 and 7; in and out may be the same.
+template<class T>
+  sycl::event fft_2d(sycl::queue&, fft_direction dir, size_t rows,
+                     size_t cols, const complex<T>* in, complex<T>* out,
+                     T scale = 1, const std::vector<sycl::event>& deps = {});
+template<class T>
+  sycl::event fft_3d(sycl::queue&, fft_direction dir, size_t n0, size_t n1,
+                     size_t n2, const complex<T>* in, complex<T>* out,
+                     T scale = 1, const std::vector<sycl::event>& deps = {});
+
+// Forward transforms of batch real signals of even length n, in[b * n + j],
+// giving the half-spectra out[b * (n / 2 + 1) + k] for k <= n / 2; the rest
+// follows from X[n - k] = conj(X[k]). fft_c2r is the backward transform of
+// such half-spectra, so fft_c2r(fft_r2c(x)) is n x without scaling. n / 2
+// must factor into 2, 3, 5 and 7, and in and out must not overlap.
+template<class T>
+  sycl::event fft_r2c(sycl::queue&, size_t n, size_t batch, const T* in,
+                      complex<T>* out, T scale = 1,
+                      const std::vector<sycl::event>& deps = {});
+template<class T>
+  sycl::event fft_c2r(sycl::queue&, size_t n, size_t batch,
+                      const complex<T>* in, T* out, T scale = 1,
+                      const std::vector<sycl::event>& deps = {});
+
+// table[k] = exp(-+2 pi i k / n) for k < n in device memory of the queue's
+// context and device, generated on the device the first time it is asked
+// for and cached per (n, dir, T) until release_twiddle_tables(). The
+// transforms above take their twiddles from these tables, or from tables
+// computed at compile time when the length is a template parameter.
+template<class T>
+  const complex<T>* twiddle_table(sycl::queue&, size_t n, fft_direction dir);
+
+// Frees every cached table. No transform may still be running.
+void release_twiddle_tables();
+
+// The same transform for a compile-time power-of-two length 8 <= N <= 1024,
+// each transform held in the registers of part of a sub-group and exchanged
+// with sub-group shuffles. Throws sycl::exception with
+// errc::feature_not_supported if the device has no sub-group size of 8, 16,
+// 32 or 64.
+template<size_t N, class T>
+  sycl::event fft_batch(sycl::queue&, fft_direction dir, size_t batch,
+                        const complex<T>* in, complex<T>* out, T scale = 1,
+                        const std::vector<sycl::event>& deps = {});
+
+}  // sycl::ext::cplx
+
+*/
+
+// clang-format on
+
+#include "sycl_ext_complex.hpp"
+#include "sycl_ext_complex_algorithm.hpp"
+#include "sycl_ext_complex_blas.hpp"
+#include "sycl_ext_complex_group.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#define _SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD namespace sycl::ext::cplx {
+#define _SYCL_EXT_CPLX_END_NAMESPACE_STD }
+#define _SYCL_EXT_CPLX_INLINE_VISIBILITY                                       \
+  inline __attribute__((__visibility__("hidden"), __always_inline__))
+
+_SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD
+
+enum class fft_direction { forward, backward };
+
+template <class _Tp> constexpr void __check_fft_type() {
+  static_assert(std::is_same_v<_Tp, float> || std::is_same_v<_Tp, double>,
+                "fft requires complex<float> or complex<double>");
+}
+
+// exp(-+2 pi i __num / __den). The angle is split exactly into a multiple
+// of a quarter turn and a remainder of at most pi / 4, so that sincos only
+// sees small arguments and the result keeps full precision.
+template <class _Tp>
+_SYCL_EXT_CPLX_INLINE_VISIBILITY complex<_Tp>
+__twiddle(fft_direction __dir, std::size_t __num, std::size_t __den) {
+  const std::size_t __k = __num % __den;
+  const std::size_t __j = (8 * __k + __den) / (2 * __den);
+  const std::ptrdiff_t __r =
+      std::ptrdiff_t(4 * __k) - std::ptrdiff_t(__j * __den);
+  const _Tp __y =
+      _Tp(6.283185307179586476925286766559) * _Tp(__r) / _Tp(4 * __den);
+  _Tp __cy;
+  const _Tp __sy = sycl::sincos(__y, &__cy);
+  _Tp __c, __s;
+  switch (__j % 4) {
+  case 0:
+    __s = __sy, __c = __cy;
+    break;
+  case 1:
+    __s = __cy, __c = -__sy;
+    break;
+  case 2:
+    __s = -__sy, __c = -__cy;
+    break;
+  default:
+    __s = -__cy, __c = __sy;
+  }
+  return complex<_Tp>(__c, __dir == fft_direction::forward ? -__s : __s);
+}
+
+// Twiddle tables for lengths known at compile time, with the same angle
+// reduction as __twiddle and Taylor series in double for the remainder.
+
+constexpr void __constexpr_sincos(std::size_t __k, std::size_t __n,
+                                  double &__s, double &__c) {
+  __k %= __n;
+  const std::size_t __j = (8 * __k + __n) / (2 * __n);
+  const std::ptrdiff_t __r =
+      std::ptrdiff_t(4 * __k) - std::ptrdiff_t(__j * __n);
+  const double __y =
+      6.283185307179586476925286766559 * double(__r) / double(4 * __n);
+  double __ts = __y, __tc = 1, __sy = __y, __cy = 1;
+  for (int __i = 1; __i < 14; ++__i) {
+    __ts *= -__y * __y / double((2 * __i) * (2 * __i + 1));
+    __tc *= -__y * __y / double((2 * __i - 1) * (2 * __i));
+    __sy += __ts;
+    __cy += __tc;
+  }
+  switch (__j % 4) {
+  case 0:
+    __s = __sy, __c = __cy;
+    break;
+  case 1:
+    __s = __cy, __c = -__sy;
+    break;
+  case 2:
+    __s = -__sy, __c = -__cy;
+    break;
+  default:
+    __s = -__cy, __c = __sy;
+  }
+}
+
+template <class _Tp, std::size_t _Np> struct __fft_table {
+  _Tp __cos[_Np];
+  _Tp __sin[_Np];
+};
+
+template <class _Tp, std::size_t _Np>
+constexpr __fft_table<_Tp, _Np> __make_fft_table() {
+  __fft_table<_Tp, _Np> __t{};
+  for (std::size_t __k = 0; __k < _Np; ++__k) {
+    double __s = 0, __c = 0;
+    __constexpr_sincos(__k, _Np, __s, __c);
+    __t.__cos[__k] = _Tp(__c);
+    __t.__sin[__k] = _Tp(__s);
+  }
+  return __t;
+}
+
+template <class _Tp, std::size_t _Np>
+inline constexpr __fft_table<_Tp, _Np> __fft_table_v =
+    __make_fft_table<_Tp, _Np>();
+
+// exp(-+2 pi i __k / _Np) for __k < _Np.
+template <std::size_t _Np, class _Tp>
+_SYCL_EXT_CPLX_INLINE_VISIBILITY complex<_Tp>
+__static_twiddle(fft_direction __dir, std::size_t __k) {
+  const _Tp __s = __fft_table_v<_Tp, _Np>.__sin[__k];
+  return complex<_Tp>(__fft_table_v<_Tp, _Np>.__cos[__k],
+                      __dir == fft_direction::forward ? -__s : __s);
+}
+
+// In-register DFTs of the supported radices. Radix 8 is split into two
+// radix-4 halves, 3, 5 and 7 are direct sums with constant roots of unity.
+
+template <class _Tp>
+_SYCL_EXT_CPLX_INLINE_VISIBILITY complex<_Tp>
+__mul_i(const complex<_Tp> &__x, fft_direction __dir) {
+  // -i * x forward, i * x backward
+  return __dir == fft_direction::forward
+             ? complex<_Tp>(__x.imag(), -__x.real())
+             : complex<_Tp>(-__x.imag(), __x.real());
+}
+
+template <class _Tp>
+_SYCL_EXT_CPLX_INLINE_VISIBILITY void
+__dft2(complex<_Tp> &__a, complex<_Tp> &__b) {
+  const complex<_Tp> __t = __a - __b;
+  __a += __b;
+  __b = __t;
+}
+
+template <class _Tp>
+_SYCL_EXT_CPLX_INLINE_VISIBILITY void __dft4(complex<_Tp> &__a0,
+                                             complex<_Tp> &__a1,
+                                             complex<_Tp> &__a2,
+                                             complex<_Tp> &__a3,
+                                             fft_direction __dir) {
+  __dft2(__a0, __a2);
+  __dft2(__a1, __a3);
+  __a3 = __mul_i(__a3, __dir);
+  __dft2(__a0, __a1);
+  __dft2(__a2, __a3);
+  // Outputs are now in order 0, 2, 1, 3.
+  std::swap(__a1, __a2);
+}
+
+// Roots of unity cos(2 pi j / _Rp), sin(2 pi j / _Rp) for the odd radices,
+// in the working precision.
+template <class _Tp, std::size_t _Rp> struct __fft_roots;
+template <class _Tp> struct __fft_roots<_Tp, 3> {
+  static constexpr _Tp __cos[3] = {_Tp(1), _Tp(-0.5), _Tp(-0.5)};
+  static constexpr _Tp __sin[3] = {_Tp(0), _Tp(0.86602540378443864676),
+                                   _Tp(-0.86602540378443864676)};
+};
+template <class _Tp> struct __fft_roots<_Tp, 5> {
+  static constexpr _Tp __cos[5] = {
+      _Tp(1), _Tp(0.30901699437494742410), _Tp(-0.80901699437494742410),
+      _Tp(-0.80901699437494742410), _Tp(0.30901699437494742410)};
+  static constexpr _Tp __sin[5] = {
+      _Tp(0), _Tp(0.95105651629515357212), _Tp(0.58778525229247312917),
+      _Tp(-0.58778525229247312917), _Tp(-0.95105651629515357212)};
+};
+template <class _Tp> struct __fft_roots<_Tp, 7> {
+  static constexpr _Tp __cos[7] = {
+      _Tp(1),
+      _Tp(0.62348980185873353053),
+      _Tp(-0.22252093395631440429),
+      _Tp(-0.90096886790241912624),
+      _Tp(-0.90096886790241912624),
+      _Tp(-0.22252093395631440429),
+      _Tp(0.62348980185873353053)};
+  static constexpr _Tp __sin[7] = {
+      _Tp(0),
+      _Tp(0.78183148246802980871),
+      _Tp(0.97492791218182360702),
+      _Tp(0.43388373911755812048),
+      _Tp(-0.43388373911755812048),
+      _Tp(-0.97492791218182360702),
+      _Tp(-0.78183148246802980871)};
+};
+
+template <std::size_t _Rp, class _Tp>
+_SYCL_EXT_CPLX_INLINE_VISIBILITY void __dft(complex<_Tp> (&__u)[_Rp],
+                                            fft_direction __dir) {
+  if constexpr (_Rp == 2) {
+    __dft2(__u[0], __u[1]);
+  } else if constexpr (_Rp == 4) {
+    __dft4(__u[0], __u[1], __u[2], __u[3], __dir);
+  } else if constexpr (_Rp == 8) {
+    // Even and odd halves, then the radix-2 combination with w8^k.
+    const _Tp __h = _Tp(0.70710678118654752440);
+    const _Tp __sg = __dir == fft_direction::forward ? _Tp(-1) : _Tp(1);
+    __dft4(__u[0], __u[2], __u[4], __u[6], __dir);
+    __dft4(__u[1], __u[3], __u[5], __u[7], __dir);
+    __u[3] =
+        op::limited_range_multiplies(complex<_Tp>(__h, __sg * __h), __u[3]);
+    __u[5] = __mul_i(__u[5], __dir);
+    __u[7] =
+        op::limited_range_multiplies(complex<_Tp>(-__h, __sg * __h), __u[7]);
+    __dft2(__u[0], __u[1]);
+    __dft2(__u[2], __u[3]);
+    __dft2(__u[4], __u[5]);
+    __dft2(__u[6], __u[7]);
+    // Outputs are now in order 0, 4, 1, 5, 2, 6, 3, 7.
+    const complex<_Tp> __t[8] = {__u[0], __u[2], __u[4], __u[6],
+                                 __u[1], __u[3], __u[5], __u[7]};
+    for (std::size_t __j = 0; __j < 8; ++__j)
+      __u[__j] = __t[__j];
+  } else {
+    typedef __fft_roots<_Tp, _Rp> _Roots;
+    const _Tp __sg = __dir == fft_direction::forward ? _Tp(-1) : _Tp(1);
+    complex<_Tp> __out[_Rp];
+    for (std::size_t __t = 0; __t < _Rp; ++__t) {
+      complex<_Tp> __acc = __u[0];
+      for (std::size_t __q = 1; __q < _Rp; ++__q) {
+        const std::size_t __j = (__t * __q) % _Rp;
+        __acc += op::limited_range_multiplies(
+            complex<_Tp>(_Roots::__cos[__j], __sg * _Roots::__sin[__j]),
+            __u[__q]);
+      }
+      __out[__t] = __acc;
+    }
+    for (std::size_t __t = 0; __t < _Rp; ++__t)
+      __u[__t] = __out[__t];
+  }
+}
+
+// Splits __n > 1 into the radices of the stages, largest powers of two
+// first. Returns an empty list when __n has another prime factor.
+inline std::vector<std::size_t> __fft_radices(std::size_t __n) {
+  std::vector<std::size_t> __radices;
+  for (std::size_t __r : {8, 4, 2, 3, 5, 7})
+    while (__n % __r == 0) {
+      __radices.push_back(__r);
+      __n /= __r;
+    }
+  if (__n != 1)
+    __radices.clear();
+  return __radices;
+}
+
+// twiddle_table
+//
+// One cache per value type, searched linearly: a program uses few distinct
+// lengths. An entry keeps the event of the kernel that fills it, so the
+// first transform of a length waits on it instead of the host.
+
+template <class _Tp> struct __twiddle_entry {
+  sycl::context __ctx;
+  sycl::device __dev;
+  std::size_t __n;
+  fft_direction __dir;
+  complex<_Tp> *__table;
+  sycl::event __ready;
+};
+
+template <class _Tp> struct __twiddle_cache {
+  std::mutex __m_;
+  std::vector<__twiddle_entry<_Tp>> __entries_;
+
+  static __twiddle_cache &__get() {
+    static __twiddle_cache __c;
+    return __c;
+  }
+
+  void __release() {
+    std::lock_guard<std::mutex> __lock(__m_);
+    for (__twiddle_entry<_Tp> &__e : __entries_) {
+      __e.__ready.wait();
+      sycl::free(__e.__table, __e.__ctx);
+    }
+    __entries_.clear();
+  }
+};
+
+template <class _Tp>
+std::pair<const complex<_Tp> *, sycl::event>
+__twiddle_table(sycl::queue &__q, std::size_t __n, fft_direction __dir) {
+  __twiddle_cache<_Tp> &__c = __twiddle_cache<_Tp>::__get();
+  const sycl::context __ctx = __q.get_context();
+  const sycl::device __dev = __q.get_device();
+  std::lock_guard<std::mutex> __lock(__c.__m_);
+  for (const __twiddle_entry<_Tp> &__e : __c.__entries_)
+    if (__e.__n == __n && __e.__dir == __dir && __e.__ctx == __ctx &&
+        __e.__dev == __dev)
+      return {__e.__table, __e.__ready};
+
+  complex<_Tp> *__table = sycl::malloc_device<complex<_Tp>>(__n, __q);
+  if (!__table)
+    throw std::bad_alloc();
+  const sycl::event __ready =
+      __blas_for_each(__q, __n, {}, [=](std::size_t __k) {
+        __table[__k] = __twiddle<_Tp>(__dir, __k, __n);
+      });
+  __c.__entries_.push_back({__ctx, __dev, __n, __dir, __table, __ready});
+  return {__table, __ready};
+}
+
+template <class _Tp>
+const complex<_Tp> *twiddle_table(sycl::queue &__q, std::size_t __n,
+                                  fft_direction __dir) {
+  __check_fft_type<_Tp>();
+  const auto __t = __twiddle_table<_Tp>(__q, __n, __dir);
+  sycl::event(__t.second).wait();
+  return __t.first;
+}
+
+inline void release_twiddle_tables() {
+  __twiddle_cache<float>::__get().__release();
+  __twiddle_cache<double>::__get().__release();
+}
+
+// fft
+//
+// Stockham auto-sort formulation: a stage of radix R with p the product of
+// the radices before it reads x[i + t * n / R] for t < R, multiplies by the
+// twiddles exp(-+2 pi i t k / (p R)) for k = i mod p, read from the length n
+// table at t k n / (p R), takes the length-R DFT and writes
+// y[(i - k) * R + k + t * p]. The output comes out in order, with no
+// bit-reversal pass, and stages ping-pong between out and a temporary.
+//
+// Multi-dimensional transforms run the same stages along each axis in turn
+// on the whole array, as count transforms whose elements are stride apart,
+// transform b starting at (b / stride) * n * stride + b % stride. Along the
+// last axis consecutive work-items step through a transform; along the
+// others they step through neighbouring transforms. Either way accesses
+// stay unit stride across work-items and no transpose is needed.
+
+struct __fft_axis {
+  std::size_t __n;
+  std::size_t __stride;
+  std::size_t __count;
+};
+
+template <std::size_t _Rp, class _Tp>
+sycl::event __stockham_stage(sycl::queue &__q, fft_direction __dir,
+                             const __fft_axis &__a, std::size_t __p,
+                             const complex<_Tp> *__src, complex<_Tp> *__dst,
+                             const complex<_Tp> *__w, _Tp __scale,
+                             const std::vector<sycl::event> &__deps) {
+  const std::size_t __n = __a.__n, __s = __a.__stride, __count = __a.__count;
+  const std::size_t __m = __n / _Rp, __ws = __n / (__p * _Rp);
+  return __blas_for_each(__q, __count * __m, __deps, [=](std::size_t __idx) {
+    const std::size_t __b = __s == 1 ? __idx / __m : __idx % __count;
+    const std::size_t __i = __s == 1 ? __idx % __m : __idx / __count;
+    const std::size_t __base = __b / __s * __n * __s + __b % __s;
+    const complex<_Tp> *__x = __src + __base;
+    complex<_Tp> *__y = __dst + __base;
+    const std::size_t __k = __i % __p;
+
+    complex<_Tp> __u[_Rp];
+    for (std::size_t __t = 0; __t < _Rp; ++__t)
+      __u[__t] = __x[(__i + __t * __m) * __s];
+    if (__p > 1)
+      for (std::size_t __t = 1; __t < _Rp; ++__t)
+        __u[__t] =
+            op::limited_range_multiplies(__w[__t * __k * __ws], __u[__t]);
+    __dft<_Rp>(__u, __dir);
+
+    const std::size_t __j = (__i - __k) * _Rp + __k;
+    for (std::size_t __t = 0; __t < _Rp; ++__t)
+      __y[(__j + __t * __p) * __s] =
+          __scale == _Tp(1) ? __u[__t] : __u[__t] * __scale;
+  });
+}
+
+template <class _Tp>
+sycl::event __stockham_stage(sycl::queue &__q, std::size_t __radix,
+                             fft_direction __dir, const __fft_axis &__a,
+                             std::size_t __p, const complex<_Tp> *__src,
+                             complex<_Tp> *__dst, const complex<_Tp> *__w,
+                             _Tp __scale,
+                             const std::vector<sycl::event> &__deps) {
+  switch (__radix) {
+  case 2:
+    return __stockham_stage<2>(__q, __dir, __a, __p, __src, __dst, __w,
+                               __scale, __deps);
+  case 3:
+    return __stockham_stage<3>(__q, __dir, __a, __p, __src, __dst, __w,
+                               __scale, __deps);
+  case 4:
+    return __stockham_stage<4>(__q, __dir, __a, __p, __src, __dst, __w,
+                               __scale, __deps);
+  case 5:
+    return __stockham_stage<5>(__q, __dir, __a, __p, __src, __dst, __w,
+                               __scale, __deps);
+  case 7:
+    return __stockham_stage<7>(__q, __dir, __a, __p, __src, __dst, __w,
+                               __scale, __deps);
+  default:
+    return __stockham_stage<8>(__q, __dir, __a, __p, __src, __dst, __w,
+                               __scale, __deps);
+  }
+}
+
+// Transforms __total elements along each axis of __axes in turn.
+template <class _Tp>
+sycl::event __fft_axes(sycl::queue &__q, fft_direction __dir,
+                       const std::vector<__fft_axis> &__axes,
+                       std::size_t __total, const complex<_Tp> *__in,
+                       complex<_Tp> *__out, _Tp __scale,
+                       const std::vector<sycl::event> &__deps) {
+  // Check every length before queueing any work.
+  std::vector<std::vector<std::size_t>> __radices;
+  std::size_t __stages = 0;
+  for (const __fft_axis &__a : __axes) {
+    __radices.push_back(__a.__n > 1 ? __fft_radices(__a.__n)
+                                    : std::vector<std::size_t>());
+    if (__a.__n > 1 && __radices.back().empty())
+      throw std::invalid_argument("fft length must factor into 2, 3, 5 and 7");
+    __stages += __radices.back().size();
+  }
+  if (__stages == 0 || __total == 0)
+    return __blas_for_each(__q, __total, __deps, [=](std::size_t __i) {
+      __out[__i] = __in[__i] * __scale;
+    });
+
+  std::vector<sycl::event> __wait = __deps;
+  std::vector<const complex<_Tp> *> __tables;
+  for (const __fft_axis &__a : __axes) {
+    if (__a.__n <= 1) {
+      __tables.push_back(nullptr);
+      continue;
+    }
+    const auto [__w, __w_ready] = __twiddle_table<_Tp>(__q, __a.__n, __dir);
+    __tables.push_back(__w);
+    __wait.push_back(__w_ready);
+  }
+
+  complex<_Tp> *__tmp = sycl::malloc_device<complex<_Tp>>(__total, __q);
+  if (!__tmp)
+    throw std::bad_alloc();
+
+  // The last stage must land in out. In place, the first stage cannot
+  // write to out, and an odd stage count ends with a copy.
+  const bool __in_place = __in == __out;
+  sycl::event __e;
+  const complex<_Tp> *__src = __in;
+  std::size_t __s = 0;
+  for (std::size_t __d = 0; __d < __axes.size(); ++__d) {
+    std::size_t __p = 1;
+    for (std::size_t __r : __radices[__d]) {
+      const bool __to_out = __in_place ? __s % 2 == 1
+                                       : (__stages - 1 - __s) % 2 == 0;
+      complex<_Tp> *__dst = __to_out ? __out : __tmp;
+      const bool __last = __s + 1 == __stages;
+      __e = __stockham_stage(__q, __r, __dir, __axes[__d], __p, __src, __dst,
+                             __tables[__d], __last ? __scale : _Tp(1),
+                             __wait);
+      __wait = {__e};
+      __src = __dst;
+      __p *= __r;
+      ++__s;
+    }
+  }
+  if (__src != __out)
+    __e = __q.memcpy(__out, __src, __total * sizeof(complex<_Tp>), __e);
+
+  return __free_after(__q, __e, __tmp);
+}
+
+template <class _Tp>
+sycl::event fft(sycl::queue &__q, fft_direction __dir, std::size_t __n,
+                std::size_t __batch, const complex<_Tp> *__in,
+                complex<_Tp> *__out, __blas_scalar_t<_Tp> __scale = 1,
+                const std::vector<sycl::event> &__deps = {}) {
+  __check_fft_type<_Tp>();
+  return __fft_axes(__q, __dir, {{__n, 1, __batch}}, __n * __batch, __in,
+                    __out, _Tp(__scale), __deps);
+}
+
+template <class _Tp>
+sycl::event fft_2d(sycl::queue &__q, fft_direction __dir, std::size_t __rows,
+                   std::size_t __cols, const complex<_Tp> *__in,
+                   complex<_Tp> *__out, __blas_scalar_t<_Tp> __scale = 1,
+                   const std::vector<sycl::event> &__deps = {}) {
+  __check_fft_type<_Tp>();
+  return __fft_axes(__q, __dir,
+                    {{__cols, 1, __rows}, {__rows, __cols, __cols}},
+                    __rows * __cols, __in, __out, _Tp(__scale), __deps);
+}
+
+template <class _Tp>
+sycl::event fft_3d(sycl::queue &__q, fft_direction __dir, std::size_t __n0,
+                   std::size_t __n1, std::size_t __n2,
+                   const complex<_Tp> *__in, complex<_Tp> *__out,
+                   __blas_scalar_t<_Tp> __scale = 1,
+                   const std::vector<sycl::event> &__deps = {}) {
+  __check_fft_type<_Tp>();
+  return __fft_axes(__q, __dir,
+                    {{__n2, 1, __n0 * __n1},
+                     {__n1, __n2, __n0 * __n2},
+                     {__n0, __n1 * __n2, __n1 * __n2}},
+                    __n0 * __n1 * __n2, __in, __out, _Tp(__scale), __deps);
+}
+
+// fft_r2c, fft_c2r
+//
+// A real signal x of length n = 2 m is read as the complex signal
+// z[j] = x[2 j] + i x[2 j + 1] of length m. With Z its transform, the
+// even and odd halves of x have the transforms
+// E[k] = (Z[k] + conj(Z[m - k])) / 2 and O[k] = -i (Z[k] - conj(Z[m - k])) / 2,
+// and X[k] = E[k] + w^k O[k], X[m - k] = conj(E[k] - w^k O[k]) with
+// w = exp(-2 pi i / n). One work-item forms both outputs of the pair
+// (k, m - k), so the split and the twiddles take a single pass.
+// fft_c2r runs the same steps in reverse, forming 2 (E + i O) before a
+// backward transform of length m.
+
+template <class _Tp>
+sycl::event fft_r2c(sycl::queue &__q, std::size_t __n, std::size_t __batch,
+                    const _Tp *__in, complex<_Tp> *__out,
+                    __blas_scalar_t<_Tp> __scale = 1,
+                    const std::vector<sycl::event> &__deps = {}) {
+  __check_fft_type<_Tp>();
+  if (__n % 2 != 0)
+    throw std::invalid_argument("fft_r2c length must be even");
+  const std::size_t __m = __n / 2;
+  if (__m > 1 && __fft_radices(__m).empty())
+    throw std::invalid_argument("fft_r2c length / 2 must factor into 2, 3, "
+                                "5 and 7");
+  if (__m == 0 || __batch == 0)
+    return __q.submit([&](sycl::handler &__cgh) {
+      __cgh.depends_on(__deps);
+      __cgh.single_task([=] {});
+    });
+  const auto [__w, __w_ready] =
+      __twiddle_table<_Tp>(__q, __n, fft_direction::forward);
+
+  complex<_Tp> *__z = sycl::malloc_device<complex<_Tp>>(__batch * __m, __q);
+  if (!__z)
+    throw std::bad_alloc();
+  const sycl::event __e =
+      fft(__q, fft_direction::forward, __m, __batch,
+          reinterpret_cast<const complex<_Tp> *>(__in), __z, _Tp(1), __deps);
+
+  const std::size_t __pairs = __m / 2 + 1;
+  const _Tp __s = _Tp(__scale) / 2;
+  const sycl::event __post = __blas_for_each(
+      __q, __batch * __pairs, {__e, __w_ready}, [=](std::size_t __idx) {
+        const std::size_t __b = __idx / __pairs, __k = __idx % __pairs;
+        const complex<_Tp> *__zb = __z + __b * __m;
+        complex<_Tp> *__x = __out + __b * (__m + 1);
+        const complex<_Tp> __a = __zb[__k];
+        const complex<_Tp> __c = conj(__zb[__k == 0 ? 0 : __m - __k]);
+        const complex<_Tp> __even = __a + __c;
+        const complex<_Tp> __d = __a - __c;
+        const complex<_Tp> __odd = op::limited_range_multiplies(
+            __w[__k], complex<_Tp>(__d.imag(), -__d.real()));
+        __x[__k] = (__even + __odd) * __s;
+        if (2 * __k != __m)
+          __x[__m - __k] = conj(__even - __odd) * __s;
+      });
+  return __free_after(__q, __post, __z);
+}
+
+template <class _Tp>
+sycl::event fft_c2r(sycl::queue &__q, std::size_t __n, std::size_t __batch,
+                    const complex<_Tp> *__in, _Tp *__out,
+                    __blas_scalar_t<_Tp> __scale = 1,
+                    const std::vector<sycl::event> &__deps = {}) {
+  __check_fft_type<_Tp>();
+  if (__n % 2 != 0)
+    throw std::invalid_argument("fft_c2r length must be even");
+  const std::size_t __m = __n / 2;
+  if (__m > 1 && __fft_radices(__m).empty())
+    throw std::invalid_argument("fft_c2r length / 2 must factor into 2, 3, "
+                                "5 and 7");
+  if (__m == 0 || __batch == 0)
+    return __q.submit([&](sycl::handler &__cgh) {
+      __cgh.depends_on(__deps);
+      __cgh.single_task([=] {});
+    });
+  const auto [__w, __w_ready] =
+      __twiddle_table<_Tp>(__q, __n, fft_direction::backward);
+
+  complex<_Tp> *__z = sycl::malloc_device<complex<_Tp>>(__batch * __m, __q);
+  if (!__z)
+    throw std::bad_alloc();
+  std::vector<sycl::event> __wait = __deps;
+  __wait.push_back(__w_ready);
+
+  const std::size_t __pairs = __m / 2 + 1;
+  const sycl::event __pre = __blas_for_each(
+      __q, __batch * __pairs, __wait, [=](std::size_t __idx) {
+        const std::size_t __b = __idx / __pairs, __k = __idx % __pairs;
+        const complex<_Tp> *__x = __in + __b * (__m + 1);
+        complex<_Tp> *__zb = __z + __b * __m;
+        const complex<_Tp> __a = __x[__k];
+        const complex<_Tp> __c = conj(__x[__m - __k]);
+        const complex<_Tp> __even = __a + __c;
+        const complex<_Tp> __odd =
+            op::limited_range_multiplies(__w[__k], __a - __c);
+        // i * odd, and the partner's twiddle is -conj(w^k).
+        const complex<_Tp> __iodd(-__odd.imag(), __odd.real());
+        __zb[__k] = __even + __iodd;
+        if (__k != 0 && 2 * __k != __m)
+          __zb[__m - __k] = conj(__even - __iodd);
+      });
+  const sycl::event __e =
+      fft(__q, fft_direction::backward, __m, __batch, __z,
+          reinterpret_cast<complex<_Tp> *>(__out), _Tp(__scale), {__pre});
+  return __free_after(__q, __e, __z);
+}
+
+// fft_batch
+//
+// A transform of length N is spread over L lanes of a sub-group, each
+// holding E = N / L elements, with E at least 8 so that small transforms
+// share a sub-group. Writing j = lane + L * e and k = k1 + E * k2, lane
+// first takes the E-point DFT of its elements in registers, multiplies the
+// result k1 by exp(-+2 pi i lane k1 / N), and the L-point DFTs across lanes
+// are radix-2 decimation-in-frequency stages exchanging values with
+// permute_group_by_xor. Those leave lane holding X[k1 + E * rev(lane)],
+// with rev the bit reversal over log2(L) bits, which is where it stores.
+// Twiddles come from tables computed at compile time, and all register
+// indices are compile-time constants once the loops unroll.
+
+// Preferred work-group size, capped by the device.
+constexpr std::size_t __fft_batch_wg = 128;
+
+template <std::size_t _Np, std::size_t _Pp, class _Tp>
+_SYCL_EXT_CPLX_INLINE_VISIBILITY void
+__register_fft(complex<_Tp> (&__x)[_Np], fft_direction __dir) {
+  if constexpr (_Pp < _Np) {
+    constexpr std::size_t _Rp = (_Np / _Pp) % 8 == 0   ? 8
+                                : (_Np / _Pp) % 4 == 0 ? 4
+                                                       : 2;
+    constexpr std::size_t __m = _Np / _Rp;
+    complex<_Tp> __y[_Np];
+#pragma unroll
+    for (std::size_t __i = 0; __i < __m; ++__i) {
+      const std::size_t __k = __i % _Pp;
+      complex<_Tp> __u[_Rp];
+#pragma unroll
+      for (std::size_t __t = 0; __t < _Rp; ++__t)
+        __u[__t] = __x[__i + __t * __m];
+      if constexpr (_Pp > 1) {
+#pragma unroll
+        for (std::size_t __t = 1; __t < _Rp; ++__t)
+          __u[__t] = op::limited_range_multiplies(
+              __static_twiddle<_Np, _Tp>(__dir, __t * __k * (__m / _Pp)),
+              __u[__t]);
+      }
+      __dft<_Rp>(__u, __dir);
+#pragma unroll
+      for (std::size_t __t = 0; __t < _Rp; ++__t)
+        __y[(__i - __k) * _Rp + __k + __t * _Pp] = __u[__t];
+    }
+#pragma unroll
+    for (std::size_t __i = 0; __i < _Np; ++__i)
+      __x[__i] = __y[__i];
+    __register_fft<_Np, _Pp * _Rp>(__x, __dir);
+  }
+}
+
+template <std::size_t _Np, std::size_t _Sg, class _Tp>
+sycl::event __fft_batch(sycl::queue &__q, fft_direction __dir,
+                        std::size_t __batch, const complex<_Tp> *__in,
+                        complex<_Tp> *__out, _Tp __scale,
+                        const std::vector<sycl::event> &__deps) {
+  constexpr std::size_t _Ep = _Np / _Sg > 8 ? _Np / _Sg : 8;
+  constexpr std::size_t _Lp = _Np / _Ep;
+  // Whole sub-groups only, so that no transform straddles two of them.
+  const std::size_t __max_wg =
+      __q.get_device().get_info<sycl::info::device::max_work_group_size>();
+  const std::size_t __wg =
+      std::max(_Sg, std::min(__fft_batch_wg, __max_wg) / _Sg * _Sg);
+  const std::size_t __groups = (__batch * _Lp + __wg - 1) / __wg;
+  return __q.submit([&](sycl::handler &__cgh) {
+    __cgh.depends_on(__deps);
+    __cgh.parallel_for(
+        sycl::nd_range<1>(__groups * __wg, __wg),
+        [=](sycl::nd_item<1> __it) [[sycl::reqd_sub_group_size(_Sg)]] {
+          const auto __sg = __it.get_sub_group();
+          const std::size_t __gid = __it.get_global_linear_id();
+          const std::size_t __b = __gid / _Lp, __lane = __gid % _Lp;
+          // Lanes past the last transform still take part in the shuffles.
+          const bool __active = __b < __batch;
+
+          complex<_Tp> __x[_Ep];
+#pragma unroll
+          for (std::size_t __e = 0; __e < _Ep; ++__e)
+            __x[__e] = __active ? __in[__b * _Np + __lane + _Lp * __e]
+                                : complex<_Tp>();
+          __register_fft<_Ep, 1>(__x, __dir);
+
+          if constexpr (_Lp > 1) {
+#pragma unroll
+            for (std::size_t __k1 = 1; __k1 < _Ep; ++__k1)
+              __x[__k1] = op::limited_range_multiplies(
+                  __static_twiddle<_Np, _Tp>(__dir, __lane * __k1 % _Np),
+                  __x[__k1]);
+#pragma unroll
+            for (std::size_t __h = _Lp / 2; __h > 0; __h /= 2) {
+              const bool __upper = __lane & __h;
+              const complex<_Tp> __w = __static_twiddle<_Np, _Tp>(
+                  __dir, __lane % __h * (_Np / (2 * __h)));
+#pragma unroll
+              for (std::size_t __k1 = 0; __k1 < _Ep; ++__k1) {
+                const complex<_Tp> __v =
+                    permute_group_by_xor(__sg, __x[__k1], __h);
+                __x[__k1] = __upper ? op::limited_range_multiplies(
+                                          __w, __v - __x[__k1])
+                                    : __x[__k1] + __v;
+              }
+            }
+          }
+
+          if (!__active)
+            return;
+          std::size_t __rev = 0;
+          for (std::size_t __bit = 1; __bit < _Lp; __bit *= 2)
+            __rev = __rev * 2 + ((__lane & __bit) != 0);
+          complex<_Tp> *__y = __out + __b * _Np + _Ep * __rev;
+#pragma unroll
+          for (std::size_t __k1 = 0; __k1 < _Ep; ++__k1)
+            __y[__k1] = __scale == _Tp(1) ? __x[__k1] : __x[__k1] * __scale;
+        });
+  });
+}
+
+template <std::size_t _Np, class _Tp>
+sycl::event fft_batch(sycl::queue &__q, fft_direction __dir,
+                      std::size_t __batch, const complex<_Tp> *__in,
+                      complex<_Tp> *__out, __blas_scalar_t<_Tp> __scale = 1,
+                      const std::vector<sycl::event> &__deps = {}) {
+  __check_fft_type<_Tp>();
+  static_assert(_Np >= 8 && _Np <= 1024 && (_Np & (_Np - 1)) == 0,
+                "fft_batch length must be a power of two from 8 to 1024");
+  // The widest sub-group the device offers keeps the fewest elements per
+  // work-item.
+  std::size_t __sg = 0;
+  for (std::size_t __s :
+       __q.get_device().get_info<sycl::info::device::sub_group_sizes>())
+    if ((__s == 8 || __s == 16 || __s == 32 || __s == 64) && __s > __sg)
+      __sg = __s;
+  switch (__sg) {
+  case 8:
+    return __fft_batch<_Np, 8>(__q, __dir, __batch, __in, __out,
+                               _Tp(__scale), __deps);
+  case 16:
+    return __fft_batch<_Np, 16>(__q, __dir, __batch, __in, __out,
+                                _Tp(__scale), __deps);
+  case 32:
+    return __fft_batch<_Np, 32>(__q, __dir, __batch, __in, __out,
+                                _Tp(__scale), __deps);
+  case 64:
+    return __fft_batch<_Np, 64>(__q, __dir, __batch, __in, __out,
+                                _Tp(__scale), __deps);
+  default:
+    throw sycl::exception(
+        sycl::make_error_code(sycl::errc::feature_not_supported),
+        "fft_batch needs a sub-group size of 8, 16, 32 or 64");
+  }
+}
+
+_SYCL_EXT_CPLX_END_NAMESPACE_STD
+
+#undef _SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD
+#undef _SYCL_EXT_CPLX_END_NAMESPACE_STD
+#undef _SYCL_EXT_CPLX_INLINE_VISIBILITY
+
+#endif // _SYCL_EXT_CPLX_COMPLEX_FFT
@@ -0,0 +1,340 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the SyclCPLX project, under the Apache License v2.0 with LLVM
+// Exceptions. See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _SYCL_EXT_CPLX_COMPLEX_FIXED
+#define _SYCL_EXT_CPLX_COMPLEX_FIXED
+
+// clang-format off
+
+/*
+    fixed_complex synopsis
+
+namespace sycl::ext::cplx
+{
+
+// Fixed-point complex number in Q-format: each component is a signed integer
+// of type T holding value * 2^Frac. The layout is two interleaved T, which is
+// the layout of IQ samples, so arrays of raw samples can be reinterpreted.
+// Arithmetic saturates instead of wrapping; products round to nearest.
+
+template<class T, int Frac = std::numeric_limits<T>::digits>
+class fixed_complex
+{
+public:
+    typedef T value_type;
+    static constexpr int frac_bits = Frac;
+
+    constexpr fixed_complex(T re = T(), T im = T());
+    template<class U, int F> explicit fixed_complex(const fixed_complex<U, F>&);
+    template<class X> explicit fixed_complex(const complex<X>&);
+
+    template<class X> explicit operator complex<X>() const;
+
+    constexpr T real() const;
+    constexpr T imag() const;
+    void real(T);
+    void imag(T);
+
+    fixed_complex& operator+=(const fixed_complex&);
+    fixed_complex& operator-=(const fixed_complex&);
+    fixed_complex& operator*=(const fixed_complex&);
+};
+
+typedef fixed_complex<int16_t, 15> cq15;
+typedef fixed_complex<int8_t, 7>   cq7;
+
+template<class T> struct is_fixed_complex;
+
+template<class T, int F> fixed_complex<T, F> operator+(const fixed_complex<T, F>&, const fixed_complex<T, F>&);
+template<class T, int F> fixed_complex<T, F> operator-(const fixed_complex<T, F>&, const fixed_complex<T, F>&);
+template<class T, int F> fixed_complex<T, F> operator*(const fixed_complex<T, F>&, const fixed_complex<T, F>&);
+template<class T, int F> fixed_complex<T, F> operator-(const fixed_complex<T, F>&);
+template<class T, int F> bool operator==(const fixed_complex<T, F>&, const fixed_complex<T, F>&);
+template<class T, int F> bool operator!=(const fixed_complex<T, F>&, const fixed_complex<T, F>&);
+
+template<class T, int F> fixed_complex<T, F> conj(const fixed_complex<T, F>&);
+template<class T, int F> fixed_complex<T, F> scale(const fixed_complex<T, F>&, int shift);
+
+// Widening kernels, out[i] = complex<X>(in[i]) * gain.
+template<class X, class T, int F>
+  sycl::event widen(sycl::queue&, const fixed_complex<T, F>* in, complex<X>* out,
+                    size_t n, X gain = 1, const std::vector<sycl::event>& deps = {});
+// Narrowing kernel, out[i] = fixed_complex<T, F>(in[i]).
+template<class T, int F, class X>
+  sycl::event narrow(sycl::queue&, const complex<X>* in, fixed_complex<T, F>* out,
+                     size_t n, const std::vector<sycl::event>& deps = {});
+
+}  // sycl::ext::cplx
+
+*/
+
+// clang-format on
+
+#include "sycl_ext_complex.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#define _SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD namespace sycl::ext::cplx {
+#define _SYCL_EXT_CPLX_END_NAMESPACE_STD }
+#define _SYCL_EXT_CPLX_INLINE_VISIBILITY                                       \
+  inline __attribute__((__visibility__("hidden"), __always_inline__))
+
+_SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD
+
+// Accumulator wide enough for the sum of two full-scale products.
+template <class _Tp> struct __fixed_traits;
+template <> struct __fixed_traits<std::int8_t> { typedef std::int32_t _Acc; };
+template <> struct __fixed_traits<std::int16_t> { typedef std::int64_t _Acc; };
+
+template <class _Tp, class _Wide>
+_SYCL_EXT_CPLX_INLINE_VISIBILITY constexpr _Tp __saturate(_Wide __v) {
+  constexpr _Wide __lo = std::numeric_limits<_Tp>::min();
+  constexpr _Wide __hi = std::numeric_limits<_Tp>::max();
+  return static_cast<_Tp>(__v < __lo ? __lo : (__v > __hi ? __hi : __v));
+}
+
+// Arithmetic right shift by __n with round-half-up; left shift if negative.
+// Left shifts saturate to the range of _Wide and right shifts past its width
+// give 0, so any __n is defined.
+template <class _Wide>
+_SYCL_EXT_CPLX_INLINE_VISIBILITY constexpr _Wide __round_shift(_Wide __v,
+                                                               int __n) {
+  constexpr int __digits = std::numeric_limits<_Wide>::digits;
+  constexpr _Wide __hi = std::numeric_limits<_Wide>::max();
+  constexpr _Wide __lo = std::numeric_limits<_Wide>::min();
+  if (__n <= 0) {
+    if (__v == 0 || __n == 0)
+      return __v;
+    if (__n < -__digits + 1)
+      return __v > 0 ? __hi : __lo;
+    const int __k = -__n;
+    if (__v > (__hi >> __k))
+      return __hi;
+    if (__v < (__lo >> __k))
+      return __lo;
+    return __v * (_Wide(1) << __k);
+  }
+  if (__n > __digits)
+    return 0;
+  // floor(__v / 2^n + 1/2) without forming __v + 2^(n - 1).
+  return (__v >> __n) + ((__v >> (__n - 1)) & 1);
+}
+
+template <class _Tp, int _Frac = std::numeric_limits<_Tp>::digits>
+class fixed_complex {
+  static_assert(std::is_same_v<_Tp, std::int8_t> ||
+                    std::is_same_v<_Tp, std::int16_t>,
+                "fixed_complex requires an int8_t or int16_t value");
+  static_assert(_Frac >= 0 && _Frac <= std::numeric_limits<_Tp>::digits,
+                "fixed_complex fractional bits out of range");
+
+public:
+  typedef _Tp value_type;
+  static constexpr int frac_bits = _Frac;
+
+private:
+  typedef typename __fixed_traits<_Tp>::_Acc _Acc;
+
+  value_type __re_;
+  value_type __im_;
+
+  template <class _Up, int _Fp>
+  static constexpr _Tp __requantize(_Up __v) {
+    typedef typename __fixed_traits<_Up>::_Acc _UAcc;
+    typedef std::conditional_t<(sizeof(_UAcc) > sizeof(_Acc)), _UAcc, _Acc>
+        _Wide;
+    return __saturate<_Tp>(__round_shift(_Wide(__v), _Fp - _Frac));
+  }
+
+  template <class _Xp> static _Tp __from_float(_Xp __v) {
+    if (sycl::isnan(__v))
+      return _Tp(0);
+    _Xp __s = sycl::rint(sycl::ldexp(__v, _Frac));
+    // Clamp in the floating domain first so the cast below is defined.
+    __s = sycl::fmin(
+        sycl::fmax(__s, _Xp(std::numeric_limits<_Tp>::min())),
+        _Xp(std::numeric_limits<_Tp>::max()));
+    return static_cast<_Tp>(static_cast<int>(__s));
+  }
+
+public:
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY constexpr fixed_complex(
+      value_type __re = value_type(), value_type __im = value_type())
+      : __re_(__re), __im_(__im) {}
+
+  template <class _Up, int _Fp>
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY explicit constexpr fixed_complex(
+      const fixed_complex<_Up, _Fp> &__c)
+      : __re_(__requantize<_Up, _Fp>(__c.real())),
+        __im_(__requantize<_Up, _Fp>(__c.imag())) {}
+
+  template <class _Xp, class = std::enable_if_t<is_genfloat<_Xp>::value>>
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY explicit fixed_complex(
+      const complex<_Xp> &__c)
+      : __re_(__from_float(__c.real())), __im_(__from_float(__c.imag())) {}
+
+  template <class _Xp, class = std::enable_if_t<is_genfloat<_Xp>::value>>
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY explicit operator complex<_Xp>() const {
+    return complex<_Xp>(sycl::ldexp(_Xp(__re_), -_Frac),
+                        sycl::ldexp(_Xp(__im_), -_Frac));
+  }
+
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY constexpr value_type real() const {
+    return __re_;
+  }
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY constexpr value_type imag() const {
+    return __im_;
+  }
+
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY void real(value_type __re) { __re_ = __re; }
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY void imag(value_type __im) { __im_ = __im; }
+
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY fixed_complex &
+  operator+=(const fixed_complex &__c) {
+    __re_ = __saturate<_Tp>(_Acc(__re_) + _Acc(__c.__re_));
+    __im_ = __saturate<_Tp>(_Acc(__im_) + _Acc(__c.__im_));
+    return *this;
+  }
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY fixed_complex &
+  operator-=(const fixed_complex &__c) {
+    __re_ = __saturate<_Tp>(_Acc(__re_) - _Acc(__c.__re_));
+    __im_ = __saturate<_Tp>(_Acc(__im_) - _Acc(__c.__im_));
+    return *this;
+  }
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY fixed_complex &
+  operator*=(const fixed_complex &__c) {
+    _Acc __a = __re_, __b = __im_, __x = __c.__re_, __y = __c.__im_;
+    __re_ = __saturate<_Tp>(__round_shift(__a * __x - __b * __y, _Frac));
+    __im_ = __saturate<_Tp>(__round_shift(__a * __y + __b * __x, _Frac));
+    return *this;
+  }
+};
+
+typedef fixed_complex<std::int16_t, 15> cq15;
+typedef fixed_complex<std::int8_t, 7> cq7;
+
+template <class _Tp> struct is_fixed_complex : std::false_type {};
+template <class _Tp, int _Frac>
+struct is_fixed_complex<fixed_complex<_Tp, _Frac>> : std::true_type {};
+
+// 26.3.6 operators:
+
+template <class _Tp, int _Frac>
+_SYCL_EXT_CPLX_INLINE_VISIBILITY fixed_complex<_Tp, _Frac>
+operator+(const fixed_complex<_Tp, _Frac> &__x,
+          const fixed_complex<_Tp, _Frac> &__y) {
+  fixed_complex<_Tp, _Frac> __t(__x);
+  __t += __y;
+  return __t;
+}
+
+template <class _Tp, int _Frac>
+_SYCL_EXT_CPLX_INLINE_VISIBILITY fixed_complex<_Tp, _Frac>
+operator-(const fixed_complex<_Tp, _Frac> &__x,
+          const fixed_complex<_Tp, _Frac> &__y) {
+  fixed_complex<_Tp, _Frac> __t(__x);
+  __t -= __y;
+  return __t;
+}
+
+template <class _Tp, int _Frac>
+_SYCL_EXT_CPLX_INLINE_VISIBILITY fixed_complex<_Tp, _Frac>
+operator*(const fixed_complex<_Tp, _Frac> &__x,
+          const fixed_complex<_Tp, _Frac> &__y) {
+  fixed_complex<_Tp, _Frac> __t(__x);
+  __t *= __y;
+  return __t;
+}
+
+template <class _Tp, int _Frac>
+_SYCL_EXT_CPLX_INLINE_VISIBILITY fixed_complex<_Tp, _Frac>
+operator-(const fixed_complex<_Tp, _Frac> &__x) {
+  return fixed_complex<_Tp, _Frac>() - __x;
+}
+
+template <class _Tp, int _Frac>
+_SYCL_EXT_CPLX_INLINE_VISIBILITY constexpr bool
+operator==(const fixed_complex<_Tp, _Frac> &__x,
+           const fixed_complex<_Tp, _Frac> &__y) {
+  return __x.real() == __y.real() && __x.imag() == __y.imag();
+}
+
+template <class _Tp, int _Frac>
+_SYCL_EXT_CPLX_INLINE_VISIBILITY constexpr bool
+operator!=(const fixed_complex<_Tp, _Frac> &__x,
+           const fixed_complex<_Tp, _Frac> &__y) {
+  return !(__x == __y);
+}
+
+// conj
+
+template <class _Tp, int _Frac>
+SYCL_EXTERNAL _SYCL_EXT_CPLX_INLINE_VISIBILITY fixed_complex<_Tp, _Frac>
+conj(const fixed_complex<_Tp, _Frac> &__c) {
+  typedef typename __fixed_traits<_Tp>::_Acc _Acc;
+  return fixed_complex<_Tp, _Frac>(__c.real(),
+                                   __saturate<_Tp>(-_Acc(__c.imag())));
+}
+
+// scale, multiplies by 2^shift with saturation and rounding
+
+template <class _Tp, int _Frac>
+SYCL_EXTERNAL _SYCL_EXT_CPLX_INLINE_VISIBILITY fixed_complex<_Tp, _Frac>
+scale(const fixed_complex<_Tp, _Frac> &__c, int __shift) {
+  typedef typename __fixed_traits<_Tp>::_Acc _Acc;
+  // Shifts beyond the accumulator width saturate or vanish anyway; bounding
+  // them first also keeps -__shift defined for INT_MIN.
+  constexpr int __max = std::numeric_limits<_Acc>::digits + 1;
+  const int __n =
+      __shift > __max ? -__max : (__shift < -__max ? __max : -__shift);
+  return fixed_complex<_Tp, _Frac>(
+      __saturate<_Tp>(__round_shift(_Acc(__c.real()), __n)),
+      __saturate<_Tp>(__round_shift(_Acc(__c.imag()), __n)));
+}
+
+// widen / narrow
+
+template <class _Xp, class _Tp, int _Frac>
+sycl::event widen(sycl::queue &__q, const fixed_complex<_Tp, _Frac> *__in,
+                  complex<_Xp> *__out, std::size_t __n,
+                  typename complex<_Xp>::value_type __gain = 1,
+                  const std::vector<sycl::event> &__deps = {}) {
+  // Fold the Q-format scale into the gain so each component costs one
+  // convert and one multiply.
+  const _Xp __k = sycl::ldexp(__gain, -_Frac);
+  return __q.submit([&](sycl::handler &__cgh) {
+    __cgh.depends_on(__deps);
+    __cgh.parallel_for(sycl::range<1>(__n), [=](sycl::id<1> __i) {
+      const fixed_complex<_Tp, _Frac> __v = __in[__i];
+      __out[__i] = complex<_Xp>(_Xp(__v.real()) * __k, _Xp(__v.imag()) * __k);
+    });
+  });
+}
+
+template <class _Tp, int _Frac, class _Xp>
+sycl::event narrow(sycl::queue &__q, const complex<_Xp> *__in,
+                   fixed_complex<_Tp, _Frac> *__out, std::size_t __n,
+                   const std::vector<sycl::event> &__deps = {}) {
+  return __q.submit([&](sycl::handler &__cgh) {
+    __cgh.depends_on(__deps);
+    __cgh.parallel_for(sycl::range<1>(__n), [=](sycl::id<1> __i) {
+      __out[__i] = fixed_complex<_Tp, _Frac>(__in[__i]);
+    });
+  });
+}
+
+_SYCL_EXT_CPLX_END_NAMESPACE_STD
+
+#undef _SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD
+#undef _SYCL_EXT_CPLX_END_NAMESPACE_STD
+#undef _SYCL_EXT_CPLX_INLINE_VISIBILITY
+
+#endif // _SYCL_EXT_CPLX_COMPLEX_FIXED
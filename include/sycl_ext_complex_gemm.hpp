@@ -0,0 +1,409 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the SyclCPLX project, under the Apache License v2.0 with LLVM
+// Exceptions. See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _SYCL_EXT_CPLX_COMPLEX_GEMM
+#define _SYCL_EXT_CPLX_COMPLEX_GEMM
+
+// clang-format off
+
+/*
+    gemm synopsis
+
+namespace sycl::ext::cplx
+{
+
+// C = alpha * op(A) * op(B) + beta * C over complex<T> USM matrices (T is
+// half, float or double), with op(A) m x k, op(B) k x n and C m x n, all in
+// the same layout. C is not read when beta is 0.
+template<class T>
+  sycl::event gemm(sycl::queue&, layout, transpose transa, transpose transb,
+                   size_t m, size_t n, size_t k, complex<T> alpha,
+                   const complex<T>* a, size_t lda, const complex<T>* b,
+                   size_t ldb, complex<T> beta, complex<T>* c, size_t ldc,
+                   const std::vector<sycl::event>& deps = {});
+
+// As gemm, with three real multiplications per complex product instead of
+// four (the 3M method). Faster where multiplications dominate, with a larger
+// error bound on the imaginary part.
+template<class T>
+  sycl::event gemm3m(sycl::queue&, layout, transpose transa, transpose transb,
+                     size_t m, size_t n, size_t k, complex<T> alpha,
+                     const complex<T>* a, size_t lda, const complex<T>* b,
+                     size_t ldb, complex<T> beta, complex<T>* c, size_t ldc,
+                     const std::vector<sycl::event>& deps = {});
+
+// batch independent gemm of compile-time size M x N x K, N <= 256, matrix i
+// at a + i * stride_a, b + i * stride_b and c + i * stride_c.
+template<size_t M, size_t N, size_t K, class T>
+  sycl::event gemm_batch(sycl::queue&, layout, transpose transa,
+                         transpose transb, complex<T> alpha,
+                         const complex<T>* a, size_t lda, size_t stride_a,
+                         const complex<T>* b, size_t ldb, size_t stride_b,
+                         complex<T> beta, complex<T>* c, size_t ldc,
+                         size_t stride_c, size_t batch,
+                         const std::vector<sycl::event>& deps = {});
+
+// As above, matrix i at a[i], b[i] and c[i].
+template<size_t M, size_t N, size_t K, class T>
+  sycl::event gemm_batch(sycl::queue&, layout, transpose transa,
+                         transpose transb, complex<T> alpha,
+                         const complex<T>* const* a, size_t lda,
+                         const complex<T>* const* b, size_t ldb,
+                         complex<T> beta, complex<T>* const* c, size_t ldc,
+                         size_t batch,
+                         const std::vector<sycl::event>& deps = {});
+
+}  // sycl::ext::cplx
+
+*/
+
+// clang-format on
+
+#include "sycl_ext_complex.hpp"
+#include "sycl_ext_complex_blas.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#define _SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD namespace sycl::ext::cplx {
+#define _SYCL_EXT_CPLX_END_NAMESPACE_STD }
+#define _SYCL_EXT_CPLX_INLINE_VISIBILITY                                       \
+  inline __attribute__((__visibility__("hidden"), __always_inline__))
+
+_SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD
+
+// Element (__i, __j) of op(M), for M stored with leading dimension __ld.
+template <class _Tp>
+_SYCL_EXT_CPLX_INLINE_VISIBILITY complex<_Tp>
+__matrix_op_element(const complex<_Tp> *__p, std::size_t __ld, layout __l,
+                    transpose __t, std::size_t __i, std::size_t __j) {
+  const std::size_t __r = __t == transpose::nontrans ? __i : __j;
+  const std::size_t __c = __t == transpose::nontrans ? __j : __i;
+  const complex<_Tp> __v =
+      __l == layout::row_major ? __p[__r * __ld + __c] : __p[__r + __c * __ld];
+  return __t == transpose::conjtrans ? complex<_Tp>(__v.real(), -__v.imag())
+                                     : __v;
+}
+
+// gemm
+//
+// Each work-group computes a __gemm_tile x __gemm_tile block of C, stepping
+// through k in slices of __gemm_tile_k. Every slice of op(A) and op(B) is
+// staged in local memory as separate real and imaginary planes, padded by
+// one column against bank conflicts, and each work-item accumulates a
+// __gemm_reg x __gemm_reg block of C in registers.
+//
+// With 3M the tiles hold a third plane with re + im, so that each product
+// costs three FMAs, into
+//   s1 = sum ar * br,  s2 = sum ai * bi,  s3 = sum (ar + ai) * (br + bi)
+// with re = s1 - s2 and im = s3 - s1 - s2, instead of four.
+
+constexpr std::size_t __gemm_tile = 32;
+constexpr std::size_t __gemm_tile_k = 16;
+constexpr std::size_t __gemm_reg = 2;
+
+template <bool _3M, class _Tp>
+sycl::event __gemm(sycl::queue &__q, layout __l, transpose __transa,
+                   transpose __transb, std::size_t __m, std::size_t __n,
+                   std::size_t __k, complex<_Tp> __alpha,
+                   const complex<_Tp> *__a, std::size_t __lda,
+                   const complex<_Tp> *__b, std::size_t __ldb,
+                   complex<_Tp> __beta, complex<_Tp> *__c, std::size_t __ldc,
+                   const std::vector<sycl::event> &__deps) {
+  static_assert(is_genfloat<_Tp>::value, "gemm requires half, float or double");
+  typedef typename __blas_accumulator<_Tp>::type _Acc;
+  constexpr std::size_t __bm = __gemm_tile, __bk = __gemm_tile_k;
+  constexpr std::size_t __r_ = __gemm_reg, __wg = __bm / __r_;
+  constexpr std::size_t __pitch = __bm + 1;
+  constexpr std::size_t __plane = __bk * __pitch;
+  constexpr std::size_t __planes = _3M ? 3 : 2;
+
+  if (__m == 0 || __n == 0)
+    return __q.submit([&](sycl::handler &__cgh) {
+      __cgh.depends_on(__deps);
+      __cgh.single_task([=] {});
+    });
+
+  const sycl::range<2> __global((__m + __bm - 1) / __bm * __wg,
+                                (__n + __bm - 1) / __bm * __wg);
+  return __q.submit([&](sycl::handler &__cgh) {
+    __cgh.depends_on(__deps);
+    sycl::local_accessor<_Acc, 1> __as(sycl::range<1>(__planes * __plane),
+                                       __cgh);
+    sycl::local_accessor<_Acc, 1> __bs(sycl::range<1>(__planes * __plane),
+                                       __cgh);
+    __cgh.parallel_for(
+        sycl::nd_range<2>(__global, sycl::range<2>(__wg, __wg)),
+        [=](sycl::nd_item<2> __it) {
+          const std::size_t __li = __it.get_local_id(0);
+          const std::size_t __lj = __it.get_local_id(1);
+          const std::size_t __lid = __li * __wg + __lj;
+          const std::size_t __i0 = __it.get_group(0) * __bm;
+          const std::size_t __j0 = __it.get_group(1) * __bm;
+
+          // s1/s2/s3 for 3M, re/im/unused otherwise
+          _Acc __s[__r_][__r_][3] = {};
+
+          for (std::size_t __k0 = 0; __k0 < __k; __k0 += __bk) {
+            // Stage op(A)(i0.., k0..) and op(B)(k0.., j0..), zero outside.
+            for (std::size_t __e = __lid; __e < __bm * __bk;
+                 __e += __wg * __wg) {
+              const std::size_t __x = __e % __bm, __kk = __e / __bm;
+              const std::size_t __kg = __k0 + __kk;
+              complex<_Tp> __av, __bv;
+              if (__i0 + __x < __m && __kg < __k)
+                __av = __matrix_op_element(__a, __lda, __l, __transa,
+                                           __i0 + __x, __kg);
+              if (__j0 + __x < __n && __kg < __k)
+                __bv = __matrix_op_element(__b, __ldb, __l, __transb, __kg,
+                                           __j0 + __x);
+              const std::size_t __o = __kk * __pitch + __x;
+              __as[__o] = _Acc(__av.real());
+              __as[__plane + __o] = _Acc(__av.imag());
+              __bs[__o] = _Acc(__bv.real());
+              __bs[__plane + __o] = _Acc(__bv.imag());
+              if constexpr (_3M) {
+                __as[2 * __plane + __o] = _Acc(__av.real()) + _Acc(__av.imag());
+                __bs[2 * __plane + __o] = _Acc(__bv.real()) + _Acc(__bv.imag());
+              }
+            }
+            sycl::group_barrier(__it.get_group());
+
+            for (std::size_t __kk = 0; __kk < __bk; ++__kk) {
+              _Acc __ar[__r_][3], __br[__r_][3];
+              for (std::size_t __r = 0; __r < __r_; ++__r)
+                for (std::size_t __p = 0; __p < __planes; ++__p) {
+                  const std::size_t __o = __p * __plane + __kk * __pitch;
+                  __ar[__r][__p] = __as[__o + __li + __r * __wg];
+                  __br[__r][__p] = __bs[__o + __lj + __r * __wg];
+                }
+              for (std::size_t __ri = 0; __ri < __r_; ++__ri)
+                for (std::size_t __rj = 0; __rj < __r_; ++__rj) {
+                  _Acc *__acc = __s[__ri][__rj];
+                  const _Acc *__x = __ar[__ri], *__y = __br[__rj];
+                  if constexpr (_3M) {
+                    __acc[0] = sycl::fma(__x[0], __y[0], __acc[0]);
+                    __acc[1] = sycl::fma(__x[1], __y[1], __acc[1]);
+                    __acc[2] = sycl::fma(__x[2], __y[2], __acc[2]);
+                  } else {
+                    __acc[0] = sycl::fma(__x[0], __y[0], __acc[0]);
+                    __acc[0] = sycl::fma(-__x[1], __y[1], __acc[0]);
+                    __acc[1] = sycl::fma(__x[0], __y[1], __acc[1]);
+                    __acc[1] = sycl::fma(__x[1], __y[0], __acc[1]);
+                  }
+                }
+            }
+            sycl::group_barrier(__it.get_group());
+          }
+
+          for (std::size_t __ri = 0; __ri < __r_; ++__ri)
+            for (std::size_t __rj = 0; __rj < __r_; ++__rj) {
+              const std::size_t __i = __i0 + __li + __ri * __wg;
+              const std::size_t __j = __j0 + __lj + __rj * __wg;
+              if (__i >= __m || __j >= __n)
+                continue;
+              const _Acc *__acc = __s[__ri][__rj];
+              const complex<_Tp> __v =
+                  _3M ? complex<_Tp>(_Tp(__acc[0] - __acc[1]),
+                                     _Tp(__acc[2] - __acc[0] - __acc[1]))
+                      : complex<_Tp>(_Tp(__acc[0]), _Tp(__acc[1]));
+              complex<_Tp> *__cij = __l == layout::row_major
+                                        ? __c + __i * __ldc + __j
+                                        : __c + __i + __j * __ldc;
+              *__cij = __blas_update(__alpha, __v, __beta, __cij);
+            }
+        });
+  });
+}
+
+template <class _Tp>
+sycl::event gemm(sycl::queue &__q, layout __l, transpose __transa,
+                 transpose __transb, std::size_t __m, std::size_t __n,
+                 std::size_t __k, __blas_scalar_t<complex<_Tp>> __alpha,
+                 const complex<_Tp> *__a, std::size_t __lda,
+                 const complex<_Tp> *__b, std::size_t __ldb,
+                 __blas_scalar_t<complex<_Tp>> __beta, complex<_Tp> *__c,
+                 std::size_t __ldc,
+                 const std::vector<sycl::event> &__deps = {}) {
+  return __gemm<false>(__q, __l, __transa, __transb, __m, __n, __k, __alpha,
+                       __a, __lda, __b, __ldb, __beta, __c, __ldc, __deps);
+}
+
+template <class _Tp>
+sycl::event gemm3m(sycl::queue &__q, layout __l, transpose __transa,
+                   transpose __transb, std::size_t __m, std::size_t __n,
+                   std::size_t __k, __blas_scalar_t<complex<_Tp>> __alpha,
+                   const complex<_Tp> *__a, std::size_t __lda,
+                   const complex<_Tp> *__b, std::size_t __ldb,
+                   __blas_scalar_t<complex<_Tp>> __beta, complex<_Tp> *__c,
+                   std::size_t __ldc,
+                   const std::vector<sycl::event> &__deps = {}) {
+  return __gemm<true>(__q, __l, __transa, __transb, __m, __n, __k, __alpha,
+                      __a, __lda, __b, __ldb, __beta, __c, __ldc, __deps);
+}
+
+// gemm_batch
+//
+// With the sizes known at compile time every loop below unrolls. Matrices
+// with at most __gemm_batch_registers outputs get one work-item each and
+// stay in registers. Larger ones get one work-item per column of C: the
+// items of a matrix share op(A) through local memory, each streaming its
+// column of op(B) and keeping its column of C in registers. Several small
+// matrices share a work-group, bounded by the local memory they need. When
+// the device cannot hold one group's op(A) or its work-items, every matrix
+// falls back to a single work-item.
+
+constexpr std::size_t __gemm_batch_registers = 16;
+constexpr std::size_t __gemm_batch_group = 256;
+constexpr std::size_t __gemm_batch_local = 1024;
+
+template <std::size_t _Mp, std::size_t _Np, std::size_t _Kp, class _Tp,
+          class _GetA, class _GetB, class _GetC>
+sycl::event __gemm_batch(sycl::queue &__q, layout __l, transpose __transa,
+                         transpose __transb, complex<_Tp> __alpha,
+                         _GetA __get_a, std::size_t __lda, _GetB __get_b,
+                         std::size_t __ldb, complex<_Tp> __beta,
+                         _GetC __get_c, std::size_t __ldc, std::size_t __batch,
+                         const std::vector<sycl::event> &__deps) {
+  static_assert(is_genfloat<_Tp>::value,
+                "gemm_batch requires half, float or double");
+  static_assert(_Mp > 0 && _Np > 0, "gemm_batch requires non-empty matrices");
+  static_assert(_Np <= __gemm_batch_group,
+                "gemm_batch supports at most 256 columns");
+  typedef typename __blas_accumulator<_Tp>::type _Acc;
+
+  const auto __store = [=](complex<_Tp> *__c, std::size_t __i, std::size_t __j,
+                           _Acc __re, _Acc __im) {
+    complex<_Tp> *__cij = __l == layout::row_major ? __c + __i * __ldc + __j
+                                                   : __c + __i + __j * __ldc;
+    *__cij = __blas_update(__alpha, complex<_Tp>(_Tp(__re), _Tp(__im)),
+                           __beta, __cij);
+  };
+
+  const auto __per_matrix = [&]() {
+    return __blas_for_each(__q, __batch, __deps, [=](std::size_t __m) {
+      const complex<_Tp> *__a = __get_a(__m), *__b = __get_b(__m);
+      _Acc __re[_Mp][_Np] = {}, __im[_Mp][_Np] = {};
+      for (std::size_t __p = 0; __p < _Kp; ++__p) {
+        complex<_Tp> __av[_Mp], __bv[_Np];
+        for (std::size_t __i = 0; __i < _Mp; ++__i)
+          __av[__i] = __matrix_op_element(__a, __lda, __l, __transa, __i, __p);
+        for (std::size_t __j = 0; __j < _Np; ++__j)
+          __bv[__j] = __matrix_op_element(__b, __ldb, __l, __transb, __p, __j);
+        for (std::size_t __i = 0; __i < _Mp; ++__i)
+          for (std::size_t __j = 0; __j < _Np; ++__j)
+            __fma_dot<false>(__av[__i], __bv[__j], __re[__i][__j],
+                             __im[__i][__j]);
+      }
+      complex<_Tp> *__c = __get_c(__m);
+      for (std::size_t __i = 0; __i < _Mp; ++__i)
+        for (std::size_t __j = 0; __j < _Np; ++__j)
+          __store(__c, __i, __j, __re[__i][__j], __im[__i][__j]);
+    });
+  };
+
+  if constexpr (_Mp * _Np <= __gemm_batch_registers) {
+    return __per_matrix();
+  } else {
+    constexpr std::size_t __a_size = _Mp * _Kp > 0 ? _Mp * _Kp : 1;
+    constexpr std::size_t __per_group =
+        std::max<std::size_t>(1, std::min(__gemm_batch_group / _Np,
+                                          __gemm_batch_local / __a_size));
+    constexpr std::size_t __wg = __per_group * _Np;
+    // A single op(A) may still outgrow the device; one work-item per matrix
+    // needs neither local memory nor a large group.
+    const sycl::device __d = __q.get_device();
+    if (__wg > __d.get_info<sycl::info::device::max_work_group_size>() ||
+        __per_group * __a_size * sizeof(complex<_Tp>) >
+            __d.get_info<sycl::info::device::local_mem_size>())
+      return __per_matrix();
+    const std::size_t __groups = (__batch + __per_group - 1) / __per_group;
+    return __q.submit([&](sycl::handler &__cgh) {
+      __cgh.depends_on(__deps);
+      sycl::local_accessor<complex<_Tp>, 1> __as(
+          sycl::range<1>(__per_group * __a_size), __cgh);
+      __cgh.parallel_for(
+          sycl::nd_range<1>(__groups * __wg, __wg), [=](sycl::nd_item<1> __it) {
+            const std::size_t __lid = __it.get_local_id(0);
+            const std::size_t __first = __it.get_group(0) * __per_group;
+
+            // op(A) of every matrix of the group, column by column
+            for (std::size_t __e = __lid; __e < __per_group * _Mp * _Kp;
+                 __e += __wg) {
+              const std::size_t __lm = __e / (_Mp * _Kp);
+              const std::size_t __r = __e % (_Mp * _Kp);
+              if (__first + __lm < __batch)
+                __as[__lm * __a_size + __r] = __matrix_op_element(
+                    __get_a(__first + __lm), __lda, __l, __transa, __r % _Mp,
+                    __r / _Mp);
+            }
+            sycl::group_barrier(__it.get_group());
+
+            const std::size_t __lm = __lid / _Np, __j = __lid % _Np;
+            if (__first + __lm >= __batch)
+              return;
+            const complex<_Tp> *__b = __get_b(__first + __lm);
+            _Acc __re[_Mp] = {}, __im[_Mp] = {};
+            for (std::size_t __p = 0; __p < _Kp; ++__p) {
+              const complex<_Tp> __bv =
+                  __matrix_op_element(__b, __ldb, __l, __transb, __p, __j);
+              for (std::size_t __i = 0; __i < _Mp; ++__i)
+                __fma_dot<false>(__as[__lm * __a_size + __p * _Mp + __i], __bv,
+                                 __re[__i], __im[__i]);
+            }
+            complex<_Tp> *__c = __get_c(__first + __lm);
+            for (std::size_t __i = 0; __i < _Mp; ++__i)
+              __store(__c, __i, __j, __re[__i], __im[__i]);
+          });
+    });
+  }
+}
+
+template <std::size_t _Mp, std::size_t _Np, std::size_t _Kp, class _Tp>
+sycl::event
+gemm_batch(sycl::queue &__q, layout __l, transpose __transa,
+           transpose __transb, __blas_scalar_t<complex<_Tp>> __alpha,
+           const complex<_Tp> *__a, std::size_t __lda, std::size_t __stride_a,
+           const complex<_Tp> *__b, std::size_t __ldb, std::size_t __stride_b,
+           __blas_scalar_t<complex<_Tp>> __beta, complex<_Tp> *__c,
+           std::size_t __ldc, std::size_t __stride_c, std::size_t __batch,
+           const std::vector<sycl::event> &__deps = {}) {
+  return __gemm_batch<_Mp, _Np, _Kp>(
+      __q, __l, __transa, __transb, __alpha,
+      [=](std::size_t __m) { return __a + __m * __stride_a; }, __lda,
+      [=](std::size_t __m) { return __b + __m * __stride_b; }, __ldb, __beta,
+      [=](std::size_t __m) { return __c + __m * __stride_c; }, __ldc, __batch,
+      __deps);
+}
+
+template <std::size_t _Mp, std::size_t _Np, std::size_t _Kp, class _Tp>
+sycl::event gemm_batch(sycl::queue &__q, layout __l, transpose __transa,
+                       transpose __transb,
+                       __blas_scalar_t<complex<_Tp>> __alpha,
+                       const complex<_Tp> *const *__a, std::size_t __lda,
+                       const complex<_Tp> *const *__b, std::size_t __ldb,
+                       __blas_scalar_t<complex<_Tp>> __beta,
+                       complex<_Tp> *const *__c, std::size_t __ldc,
+                       std::size_t __batch,
+                       const std::vector<sycl::event> &__deps = {}) {
+  return __gemm_batch<_Mp, _Np, _Kp>(
+      __q, __l, __transa, __transb, __alpha,
+      [=](std::size_t __m) { return __a[__m]; }, __lda,
+      [=](std::size_t __m) { return __b[__m]; }, __ldb, __beta,
+      [=](std::size_t __m) { return __c[__m]; }, __ldc, __batch, __deps);
+}
+
+_SYCL_EXT_CPLX_END_NAMESPACE_STD
+
+#undef _SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD
+#undef _SYCL_EXT_CPLX_END_NAMESPACE_STD
+#undef _SYCL_EXT_CPLX_INLINE_VISIBILITY
+
+#endif // _SYCL_EXT_CPLX_COMPLEX_GEMM
@@ -0,0 +1,336 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the SyclCPLX project, under the Apache License v2.0 with LLVM
+// Exceptions. See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _SYCL_EXT_CPLX_COMPLEX_GROUP
+#define _SYCL_EXT_CPLX_COMPLEX_GROUP
+
+// clang-format off
+
+/*
+    group algorithms synopsis
+
+namespace sycl::ext::cplx
+{
+
+// Complex counterparts of sycl::plus and sycl::multiplies. sycl::plus and
+// sycl::multiplies over complex<T> are accepted by the algorithms below too.
+template<class T = void> struct plus;
+template<class T = void> struct multiplies;
+
+// Overloads of the SYCL group algorithms for complex<T> (T is half, float or
+// double). The real and imaginary parts are exchanged separately with the
+// scalar algorithms and recombined, so every work-item of the group must
+// make the call, as for the scalar algorithms.
+//
+// Reductions and scans with plus work on any group. Other operators, such as
+// multiplies, need the shuffles of a sub-group and are only provided for
+// sycl::sub_group.
+
+template<class Group, class T>
+  complex<T> group_broadcast(Group g, complex<T> x);
+template<class Group, class T>
+  complex<T> group_broadcast(Group g, complex<T> x,
+                             typename Group::linear_id_type local_linear_id);
+
+template<class Group, class T>
+  complex<T> select_from_group(Group g, complex<T> x, typename Group::id_type remote_local_id);
+template<class Group, class T>
+  complex<T> shift_group_left(Group g, complex<T> x, typename Group::linear_id_type delta = 1);
+template<class Group, class T>
+  complex<T> shift_group_right(Group g, complex<T> x, typename Group::linear_id_type delta = 1);
+template<class Group, class T>
+  complex<T> permute_group_by_xor(Group g, complex<T> x, typename Group::linear_id_type mask);
+
+template<class Group, class T, class BinaryOperation>
+  complex<T> reduce_over_group(Group g, complex<T> x, BinaryOperation op);
+template<class Group, class T, class BinaryOperation>
+  complex<T> reduce_over_group(Group g, complex<T> x, complex<T> init, BinaryOperation op);
+
+template<class Group, class T, class BinaryOperation>
+  complex<T> inclusive_scan_over_group(Group g, complex<T> x, BinaryOperation op);
+template<class Group, class T, class BinaryOperation>
+  complex<T> inclusive_scan_over_group(Group g, complex<T> x, BinaryOperation op, complex<T> init);
+template<class Group, class T, class BinaryOperation>
+  complex<T> exclusive_scan_over_group(Group g, complex<T> x, BinaryOperation op);
+template<class Group, class T, class BinaryOperation>
+  complex<T> exclusive_scan_over_group(Group g, complex<T> x, complex<T> init, BinaryOperation op);
+
+}  // sycl::ext::cplx
+
+*/
+
+// clang-format on
+
+#include "sycl_ext_complex.hpp"
+
+#include <type_traits>
+
+#define _SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD namespace sycl::ext::cplx {
+#define _SYCL_EXT_CPLX_END_NAMESPACE_STD }
+#define _SYCL_EXT_CPLX_INLINE_VISIBILITY                                       \
+  inline __attribute__((__visibility__("hidden"), __always_inline__))
+
+_SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD
+
+// Function objects
+
+template <class _Tp = void> struct plus {
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY _Tp operator()(const _Tp &__x,
+                                                  const _Tp &__y) const {
+    return __x + __y;
+  }
+};
+
+template <> struct plus<void> {
+  template <class _Tp, class _Up>
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY auto operator()(const _Tp &__x,
+                                                   const _Up &__y) const {
+    return __x + __y;
+  }
+};
+
+template <class _Tp = void> struct multiplies {
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY _Tp operator()(const _Tp &__x,
+                                                  const _Tp &__y) const {
+    return __x * __y;
+  }
+};
+
+template <> struct multiplies<void> {
+  template <class _Tp, class _Up>
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY auto operator()(const _Tp &__x,
+                                                   const _Up &__y) const {
+    return __x * __y;
+  }
+};
+
+// Addition is the only operator that acts on the real and imaginary parts
+// independently, so it is the only one that maps onto the scalar algorithms.
+template <class _Op, class _Tp> struct __is_complex_plus : std::false_type {};
+template <class _Tp>
+struct __is_complex_plus<sycl::plus<complex<_Tp>>, _Tp> : std::true_type {};
+template <class _Tp>
+struct __is_complex_plus<sycl::plus<void>, _Tp> : std::true_type {};
+template <class _Tp>
+struct __is_complex_plus<plus<complex<_Tp>>, _Tp> : std::true_type {};
+template <class _Tp>
+struct __is_complex_plus<plus<void>, _Tp> : std::true_type {};
+
+template <class _Group, class _Tp>
+using __enable_if_group_complex_t =
+    std::enable_if_t<sycl::is_group_v<std::decay_t<_Group>> &&
+                         is_genfloat<_Tp>::value,
+                     complex<_Tp>>;
+
+template <class _Group, class _Op, class _Tp>
+constexpr void __check_group_op() {
+  static_assert(__is_complex_plus<_Op, _Tp>::value ||
+                    std::is_same_v<std::decay_t<_Group>, sycl::sub_group>,
+                "complex group algorithms only support operators other than "
+                "plus on sycl::sub_group");
+}
+
+// Data exchange
+
+template <class _Group, class _Tp>
+SYCL_EXTERNAL _SYCL_EXT_CPLX_INLINE_VISIBILITY
+    __enable_if_group_complex_t<_Group, _Tp>
+    group_broadcast(_Group __g, complex<_Tp> __x) {
+  return complex<_Tp>(sycl::group_broadcast(__g, __x.real()),
+                      sycl::group_broadcast(__g, __x.imag()));
+}
+
+template <class _Group, class _Tp>
+SYCL_EXTERNAL _SYCL_EXT_CPLX_INLINE_VISIBILITY
+    __enable_if_group_complex_t<_Group, _Tp>
+    group_broadcast(_Group __g, complex<_Tp> __x,
+                    typename _Group::linear_id_type __local_linear_id) {
+  return complex<_Tp>(
+      sycl::group_broadcast(__g, __x.real(), __local_linear_id),
+      sycl::group_broadcast(__g, __x.imag(), __local_linear_id));
+}
+
+template <class _Group, class _Tp>
+SYCL_EXTERNAL _SYCL_EXT_CPLX_INLINE_VISIBILITY
+    __enable_if_group_complex_t<_Group, _Tp>
+    select_from_group(_Group __g, complex<_Tp> __x,
+                      typename _Group::id_type __remote_local_id) {
+  return complex<_Tp>(
+      sycl::select_from_group(__g, __x.real(), __remote_local_id),
+      sycl::select_from_group(__g, __x.imag(), __remote_local_id));
+}
+
+template <class _Group, class _Tp>
+SYCL_EXTERNAL _SYCL_EXT_CPLX_INLINE_VISIBILITY
+    __enable_if_group_complex_t<_Group, _Tp>
+    shift_group_left(_Group __g, complex<_Tp> __x,
+                     typename _Group::linear_id_type __delta = 1) {
+  return complex<_Tp>(sycl::shift_group_left(__g, __x.real(), __delta),
+                      sycl::shift_group_left(__g, __x.imag(), __delta));
+}
+
+template <class _Group, class _Tp>
+SYCL_EXTERNAL _SYCL_EXT_CPLX_INLINE_VISIBILITY
+    __enable_if_group_complex_t<_Group, _Tp>
+    shift_group_right(_Group __g, complex<_Tp> __x,
+                      typename _Group::linear_id_type __delta = 1) {
+  return complex<_Tp>(sycl::shift_group_right(__g, __x.real(), __delta),
+                      sycl::shift_group_right(__g, __x.imag(), __delta));
+}
+
+template <class _Group, class _Tp>
+SYCL_EXTERNAL _SYCL_EXT_CPLX_INLINE_VISIBILITY
+    __enable_if_group_complex_t<_Group, _Tp>
+    permute_group_by_xor(_Group __g, complex<_Tp> __x,
+                         typename _Group::linear_id_type __mask) {
+  return complex<_Tp>(sycl::permute_group_by_xor(__g, __x.real(), __mask),
+                      sycl::permute_group_by_xor(__g, __x.imag(), __mask));
+}
+
+// reduce_over_group
+
+template <class _Group, class _Tp, class _BinaryOperation>
+SYCL_EXTERNAL _SYCL_EXT_CPLX_INLINE_VISIBILITY
+    __enable_if_group_complex_t<_Group, _Tp>
+    reduce_over_group(_Group __g, complex<_Tp> __x, _BinaryOperation __op) {
+  __check_group_op<_Group, _BinaryOperation, _Tp>();
+  if constexpr (__is_complex_plus<_BinaryOperation, _Tp>::value) {
+    return complex<_Tp>(
+        sycl::reduce_over_group(__g, __x.real(), sycl::plus<_Tp>()),
+        sycl::reduce_over_group(__g, __x.imag(), sycl::plus<_Tp>()));
+  } else {
+    // Tree reduction towards work-item 0. Combining x[i] with x[i + __d]
+    // keeps the operands in order, so __op only has to be associative.
+    const auto __lid = __g.get_local_linear_id();
+    const auto __size = __g.get_local_linear_range();
+    for (typename _Group::linear_id_type __d = 1; __d < __size;
+         __d *= 2) {
+      const complex<_Tp> __y = shift_group_left(__g, __x, __d);
+      if (__lid + __d < __size)
+        __x = __op(__x, __y);
+    }
+    return group_broadcast(__g, __x);
+  }
+}
+
+template <class _Group, class _Tp, class _BinaryOperation>
+SYCL_EXTERNAL _SYCL_EXT_CPLX_INLINE_VISIBILITY
+    __enable_if_group_complex_t<_Group, _Tp>
+    reduce_over_group(_Group __g, complex<_Tp> __x, complex<_Tp> __init,
+                      _BinaryOperation __op) {
+  return __op(__init, reduce_over_group(__g, __x, __op));
+}
+
+// inclusive_scan_over_group
+
+template <class _Group, class _Tp, class _BinaryOperation>
+SYCL_EXTERNAL _SYCL_EXT_CPLX_INLINE_VISIBILITY
+    __enable_if_group_complex_t<_Group, _Tp>
+    inclusive_scan_over_group(_Group __g, complex<_Tp> __x,
+                              _BinaryOperation __op) {
+  __check_group_op<_Group, _BinaryOperation, _Tp>();
+  if constexpr (__is_complex_plus<_BinaryOperation, _Tp>::value) {
+    return complex<_Tp>(
+        sycl::inclusive_scan_over_group(__g, __x.real(), sycl::plus<_Tp>()),
+        sycl::inclusive_scan_over_group(__g, __x.imag(), sycl::plus<_Tp>()));
+  } else {
+    // Hillis-Steele scan, again keeping the operands in order.
+    const auto __lid = __g.get_local_linear_id();
+    const auto __size = __g.get_local_linear_range();
+    for (typename _Group::linear_id_type __d = 1; __d < __size;
+         __d *= 2) {
+      const complex<_Tp> __y = shift_group_right(__g, __x, __d);
+      if (__lid >= __d)
+        __x = __op(__y, __x);
+    }
+    return __x;
+  }
+}
+
+template <class _Group, class _Tp, class _BinaryOperation>
+SYCL_EXTERNAL _SYCL_EXT_CPLX_INLINE_VISIBILITY
+    __enable_if_group_complex_t<_Group, _Tp>
+    inclusive_scan_over_group(_Group __g, complex<_Tp> __x,
+                              _BinaryOperation __op, complex<_Tp> __init) {
+  return __op(__init, inclusive_scan_over_group(__g, __x, __op));
+}
+
+// exclusive_scan_over_group
+
+template <class _Group, class _Tp, class _BinaryOperation>
+SYCL_EXTERNAL _SYCL_EXT_CPLX_INLINE_VISIBILITY
+    __enable_if_group_complex_t<_Group, _Tp>
+    exclusive_scan_over_group(_Group __g, complex<_Tp> __x,
+                              complex<_Tp> __init, _BinaryOperation __op) {
+  if constexpr (__is_complex_plus<_BinaryOperation, _Tp>::value) {
+    return complex<_Tp>(sycl::exclusive_scan_over_group(
+                            __g, __x.real(), __init.real(), sycl::plus<_Tp>()),
+                        sycl::exclusive_scan_over_group(
+                            __g, __x.imag(), __init.imag(), sycl::plus<_Tp>()));
+  } else {
+    const complex<_Tp> __y =
+        shift_group_right(__g, inclusive_scan_over_group(__g, __x, __op));
+    return __g.get_local_linear_id() == 0 ? __init : __op(__init, __y);
+  }
+}
+
+template <class _Group, class _Tp, class _BinaryOperation>
+SYCL_EXTERNAL _SYCL_EXT_CPLX_INLINE_VISIBILITY
+    __enable_if_group_complex_t<_Group, _Tp>
+    exclusive_scan_over_group(_Group __g, complex<_Tp> __x,
+                              _BinaryOperation __op) {
+  return exclusive_scan_over_group(
+      __g, __x, sycl::known_identity_v<_BinaryOperation, complex<_Tp>>, __op);
+}
+
+_SYCL_EXT_CPLX_END_NAMESPACE_STD
+
+// Reduction identities for the function objects above.
+
+namespace sycl {
+
+template <class _Tp>
+struct has_known_identity<ext::cplx::plus<ext::cplx::complex<_Tp>>,
+                          ext::cplx::complex<_Tp>> : std::true_type {};
+template <class _Tp>
+struct has_known_identity<ext::cplx::plus<void>, ext::cplx::complex<_Tp>>
+    : std::true_type {};
+template <class _Tp>
+struct has_known_identity<ext::cplx::multiplies<ext::cplx::complex<_Tp>>,
+                          ext::cplx::complex<_Tp>> : std::true_type {};
+template <class _Tp>
+struct has_known_identity<ext::cplx::multiplies<void>, ext::cplx::complex<_Tp>>
+    : std::true_type {};
+
+template <class _Tp>
+struct known_identity<ext::cplx::plus<ext::cplx::complex<_Tp>>,
+                      ext::cplx::complex<_Tp>> {
+  static constexpr ext::cplx::complex<_Tp> value{_Tp(0), _Tp(0)};
+};
+template <class _Tp>
+struct known_identity<ext::cplx::plus<void>, ext::cplx::complex<_Tp>> {
+  static constexpr ext::cplx::complex<_Tp> value{_Tp(0), _Tp(0)};
+};
+template <class _Tp>
+struct known_identity<ext::cplx::multiplies<ext::cplx::complex<_Tp>>,
+                      ext::cplx::complex<_Tp>> {
+  static constexpr ext::cplx::complex<_Tp> value{_Tp(1), _Tp(0)};
+};
+template <class _Tp>
+struct known_identity<ext::cplx::multiplies<void>, ext::cplx::complex<_Tp>> {
+  static constexpr ext::cplx::complex<_Tp> value{_Tp(1), _Tp(0)};
+};
+
+} // namespace sycl
+
+#undef _SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD
+#undef _SYCL_EXT_CPLX_END_NAMESPACE_STD
+#undef _SYCL_EXT_CPLX_INLINE_VISIBILITY
+
+#endif // _SYCL_EXT_CPLX_COMPLEX_GROUP
@@ -0,0 +1,548 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the SyclCPLX project, under the Apache License v2.0 with LLVM
+// Exceptions. See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _SYCL_EXT_CPLX_COMPLEX_LAPACK
+#define _SYCL_EXT_CPLX_COMPLEX_LAPACK
+
+// clang-format off
+
+/*
+    lapack synopsis
+
+namespace sycl::ext::cplx
+{
+
+// Batches of N x N column-major complex<T> USM matrices (T is float or
+// double, N at most 64), matrix i at a + i * stride_a with pivots at
+// ipiv + i * stride_ipiv.
+
+// LU factorization with partial pivoting, P * A = L * U, in place. ipiv is
+// 1-based as in LAPACK getrf. info[i], when info is not null, is 0 or the
+// 1-based index of the first zero pivot of matrix i.
+template<size_t N, class T>
+  sycl::event getrf_batch(sycl::queue&, complex<T>* a, size_t lda,
+                          size_t stride_a, std::int64_t* ipiv,
+                          size_t stride_ipiv, size_t batch,
+                          std::int64_t* info,
+                          const std::vector<sycl::event>& deps = {});
+
+// Solves op(A) * X = B for nrhs right-hand sides in place, from the factors
+// of getrf_batch.
+template<size_t N, class T>
+  sycl::event getrs_batch(sycl::queue&, transpose trans, size_t nrhs,
+                          const complex<T>* a, size_t lda, size_t stride_a,
+                          const std::int64_t* ipiv, size_t stride_ipiv,
+                          complex<T>* b, size_t ldb, size_t stride_b,
+                          size_t batch,
+                          const std::vector<sycl::event>& deps = {});
+
+// Replaces the factors of getrf_batch with the inverse of A.
+template<size_t N, class T>
+  sycl::event getri_batch(sycl::queue&, complex<T>* a, size_t lda,
+                          size_t stride_a, const std::int64_t* ipiv,
+                          size_t stride_ipiv, size_t batch,
+                          const std::vector<sycl::event>& deps = {});
+
+// det[i] = det(A) from the factors of getrf_batch.
+template<size_t N, class T>
+  sycl::event det_batch(sycl::queue&, const complex<T>* a, size_t lda,
+                        size_t stride_a, const std::int64_t* ipiv,
+                        size_t stride_ipiv, complex<T>* det, size_t batch,
+                        const std::vector<sycl::event>& deps = {});
+
+enum class job { novec, vec };
+
+// Eigenvalues of Hermitian A, from its upper triangle, in ascending order at
+// w + i * stride_w. With job::vec the orthonormal eigenvectors overwrite the
+// columns of A, in the same order; otherwise A is left unchanged. N is at
+// most 16: 2 x 2 and 3 x 3 are solved in closed form, larger matrices with
+// cyclic Jacobi rotations.
+template<size_t N, class T>
+  sycl::event heev_batch(sycl::queue&, job jobz, complex<T>* a, size_t lda,
+                         size_t stride_a, T* w, size_t stride_w,
+                         size_t batch,
+                         const std::vector<sycl::event>& deps = {});
+
+}  // sycl::ext::cplx
+
+*/
+
+// clang-format on
+
+#include "sycl_ext_complex.hpp"
+#include "sycl_ext_complex_blas.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#define _SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD namespace sycl::ext::cplx {
+#define _SYCL_EXT_CPLX_END_NAMESPACE_STD }
+#define _SYCL_EXT_CPLX_INLINE_VISIBILITY                                       \
+  inline __attribute__((__visibility__("hidden"), __always_inline__))
+
+_SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD
+
+// Small matrices are processed by work-groups of up to __lapack_group items,
+// with one work-item per row or column of a matrix and as many matrices as
+// fit. With N fixed at compile time each work-item keeps its row or column
+// in registers.
+constexpr std::size_t __lapack_group = 64;
+
+template <class _Tp, std::size_t _Np> constexpr void __check_lapack_types() {
+  static_assert(std::is_same_v<_Tp, float> || std::is_same_v<_Tp, double>,
+                "batched LAPACK requires complex<float> or complex<double>");
+  static_assert(_Np > 0 && _Np <= __lapack_group,
+                "batched LAPACK supports matrices up to 64 x 64");
+}
+
+template <std::size_t _Np>
+constexpr std::size_t __lapack_per_group =
+    std::max<std::size_t>(1, __lapack_group / _Np);
+
+template <std::size_t _Np>
+_SYCL_EXT_CPLX_INLINE_VISIBILITY sycl::nd_range<1>
+__lapack_range(std::size_t __batch) {
+  constexpr std::size_t __per_group = __lapack_per_group<_Np>;
+  const std::size_t __groups = (__batch + __per_group - 1) / __per_group;
+  return sycl::nd_range<1>(__groups * __per_group * _Np, __per_group * _Np);
+}
+
+// getrf_batch
+//
+// Right-looking elimination with work-item i holding row i. At step k the
+// rows vote for the pivot through local memory, by largest |re| + |im| as
+// LAPACK does, the pivot row is published there, and rows below it are
+// updated in registers.
+
+template <std::size_t _Np, class _Tp>
+sycl::event getrf_batch(sycl::queue &__q, complex<_Tp> *__a, std::size_t __lda,
+                        std::size_t __stride_a, std::int64_t *__ipiv,
+                        std::size_t __stride_ipiv, std::size_t __batch,
+                        std::int64_t *__info,
+                        const std::vector<sycl::event> &__deps = {}) {
+  __check_lapack_types<_Tp, _Np>();
+  constexpr std::size_t __per_group = __lapack_per_group<_Np>;
+  return __q.submit([&](sycl::handler &__cgh) {
+    __cgh.depends_on(__deps);
+    sycl::local_accessor<_Tp, 1> __mag(sycl::range<1>(__per_group * _Np),
+                                       __cgh);
+    sycl::local_accessor<complex<_Tp>, 1> __pivot_row(
+        sycl::range<1>(__per_group * _Np), __cgh);
+    sycl::local_accessor<complex<_Tp>, 1> __swap_row(
+        sycl::range<1>(__per_group * _Np), __cgh);
+    __cgh.parallel_for(
+        __lapack_range<_Np>(__batch), [=](sycl::nd_item<1> __it) {
+          const std::size_t __lm = __it.get_local_id(0) / _Np;
+          const std::size_t __i = __it.get_local_id(0) % _Np;
+          const std::size_t __m = __it.get_group(0) * __per_group + __lm;
+          const bool __active = __m < __batch;
+          const std::size_t __base = __lm * _Np;
+          complex<_Tp> *__am = __a + __m * __stride_a;
+
+          complex<_Tp> __row[_Np];
+          if (__active)
+            for (std::size_t __j = 0; __j < _Np; ++__j)
+              __row[__j] = __am[__i + __j * __lda];
+
+          std::int64_t __first_zero = 0;
+          for (std::size_t __k = 0; __k < _Np; ++__k) {
+            const complex<_Tp> __v = __row[__k];
+            __mag[__base + __i] =
+                __active && __i >= __k
+                    ? sycl::fabs(__v.real()) + sycl::fabs(__v.imag())
+                    : _Tp(-1);
+            sycl::group_barrier(__it.get_group());
+
+            std::size_t __p = __k;
+            for (std::size_t __r = __k + 1; __r < _Np; ++__r)
+              if (__mag[__base + __r] > __mag[__base + __p])
+                __p = __r;
+            if (__i == __p)
+              for (std::size_t __j = 0; __j < _Np; ++__j)
+                __pivot_row[__base + __j] = __row[__j];
+            if (__i == __k)
+              for (std::size_t __j = 0; __j < _Np; ++__j)
+                __swap_row[__base + __j] = __row[__j];
+            sycl::group_barrier(__it.get_group());
+
+            if (__i == __k)
+              for (std::size_t __j = 0; __j < _Np; ++__j)
+                __row[__j] = __pivot_row[__base + __j];
+            else if (__i == __p)
+              for (std::size_t __j = 0; __j < _Np; ++__j)
+                __row[__j] = __swap_row[__base + __j];
+            if (__active && __i == 0)
+              __ipiv[__m * __stride_ipiv + __k] = std::int64_t(__p + 1);
+
+            const complex<_Tp> __piv = __pivot_row[__base + __k];
+            if (__piv == complex<_Tp>(0, 0)) {
+              if (__first_zero == 0)
+                __first_zero = std::int64_t(__k + 1);
+            } else if (__i > __k) {
+              const complex<_Tp> __l = __row[__k] / __piv;
+              __row[__k] = __l;
+              for (std::size_t __j = __k + 1; __j < _Np; ++__j)
+                __row[__j] -= __l * __pivot_row[__base + __j];
+            }
+          }
+
+          if (__active) {
+            for (std::size_t __j = 0; __j < _Np; ++__j)
+              __am[__i + __j * __lda] = __row[__j];
+            if (__info && __i == 0)
+              __info[__m] = __first_zero;
+          }
+        });
+  });
+}
+
+// Solves op(A) * x = x in place for one column x, given P * A = L * U.
+template <std::size_t _Np, class _Tp>
+_SYCL_EXT_CPLX_INLINE_VISIBILITY void
+__lu_solve(transpose __trans, const complex<_Tp> *__a, std::size_t __lda,
+           const std::int64_t *__ipiv, complex<_Tp> (&__x)[_Np]) {
+  const auto __at = [=](std::size_t __i, std::size_t __j) {
+    const complex<_Tp> __v = __a[__i + __j * __lda];
+    return __trans == transpose::conjtrans
+               ? complex<_Tp>(__v.real(), -__v.imag())
+               : __v;
+  };
+  const auto __swap = [&](std::size_t __k) {
+    const std::size_t __p = std::size_t(__ipiv[__k] - 1);
+    const complex<_Tp> __t = __x[__k];
+    __x[__k] = __x[__p];
+    __x[__p] = __t;
+  };
+
+  if (__trans == transpose::nontrans) {
+    // L * U * x = P * b
+    for (std::size_t __k = 0; __k < _Np; ++__k)
+      __swap(__k);
+    for (std::size_t __j = 0; __j < _Np; ++__j)
+      for (std::size_t __i = __j + 1; __i < _Np; ++__i)
+        __x[__i] -= __at(__i, __j) * __x[__j];
+    for (std::size_t __j = _Np; __j-- > 0;) {
+      __x[__j] /= __at(__j, __j);
+      for (std::size_t __i = 0; __i < __j; ++__i)
+        __x[__i] -= __at(__i, __j) * __x[__j];
+    }
+  } else {
+    // op(U) * op(L) * P * x = b
+    for (std::size_t __j = 0; __j < _Np; ++__j) {
+      for (std::size_t __i = 0; __i < __j; ++__i)
+        __x[__j] -= __at(__i, __j) * __x[__i];
+      __x[__j] /= __at(__j, __j);
+    }
+    for (std::size_t __j = _Np; __j-- > 0;)
+      for (std::size_t __i = __j + 1; __i < _Np; ++__i)
+        __x[__j] -= __at(__i, __j) * __x[__i];
+    for (std::size_t __k = _Np; __k-- > 0;)
+      __swap(__k);
+  }
+}
+
+// getrs_batch
+
+template <std::size_t _Np, class _Tp>
+sycl::event
+getrs_batch(sycl::queue &__q, transpose __trans, std::size_t __nrhs,
+            const complex<_Tp> *__a, std::size_t __lda, std::size_t __stride_a,
+            const std::int64_t *__ipiv, std::size_t __stride_ipiv,
+            complex<_Tp> *__b, std::size_t __ldb, std::size_t __stride_b,
+            std::size_t __batch, const std::vector<sycl::event> &__deps = {}) {
+  __check_lapack_types<_Tp, _Np>();
+  return __blas_for_each(__q, __batch * __nrhs, __deps, [=](std::size_t __t) {
+    const std::size_t __m = __t / __nrhs;
+    complex<_Tp> *__bm = __b + __m * __stride_b + (__t % __nrhs) * __ldb;
+    complex<_Tp> __x[_Np];
+    for (std::size_t __i = 0; __i < _Np; ++__i)
+      __x[__i] = __bm[__i];
+    __lu_solve(__trans, __a + __m * __stride_a, __lda,
+               __ipiv + __m * __stride_ipiv, __x);
+    for (std::size_t __i = 0; __i < _Np; ++__i)
+      __bm[__i] = __x[__i];
+  });
+}
+
+// getri_batch
+//
+// Work-item j of a matrix solves A * x = e_j for column j of the inverse,
+// and writes it over the factors once every work-item of the matrix is done
+// reading them.
+
+template <std::size_t _Np, class _Tp>
+sycl::event getri_batch(sycl::queue &__q, complex<_Tp> *__a, std::size_t __lda,
+                        std::size_t __stride_a, const std::int64_t *__ipiv,
+                        std::size_t __stride_ipiv, std::size_t __batch,
+                        const std::vector<sycl::event> &__deps = {}) {
+  __check_lapack_types<_Tp, _Np>();
+  constexpr std::size_t __per_group = __lapack_per_group<_Np>;
+  return __q.submit([&](sycl::handler &__cgh) {
+    __cgh.depends_on(__deps);
+    __cgh.parallel_for(
+        __lapack_range<_Np>(__batch), [=](sycl::nd_item<1> __it) {
+          const std::size_t __j = __it.get_local_id(0) % _Np;
+          const std::size_t __m =
+              __it.get_group(0) * __per_group + __it.get_local_id(0) / _Np;
+          const bool __active = __m < __batch;
+          complex<_Tp> *__am = __a + __m * __stride_a;
+
+          complex<_Tp> __x[_Np];
+          if (__active) {
+            for (std::size_t __i = 0; __i < _Np; ++__i)
+              __x[__i] = complex<_Tp>(__i == __j ? 1 : 0, 0);
+            __lu_solve(transpose::nontrans, __am, __lda,
+                       __ipiv + __m * __stride_ipiv, __x);
+          }
+          sycl::group_barrier(__it.get_group());
+          if (__active)
+            for (std::size_t __i = 0; __i < _Np; ++__i)
+              __am[__i + __j * __lda] = __x[__i];
+        });
+  });
+}
+
+// det_batch
+
+template <std::size_t _Np, class _Tp>
+sycl::event det_batch(sycl::queue &__q, const complex<_Tp> *__a,
+                      std::size_t __lda, std::size_t __stride_a,
+                      const std::int64_t *__ipiv, std::size_t __stride_ipiv,
+                      complex<_Tp> *__det, std::size_t __batch,
+                      const std::vector<sycl::event> &__deps = {}) {
+  __check_lapack_types<_Tp, _Np>();
+  return __blas_for_each(__q, __batch, __deps, [=](std::size_t __m) {
+    const complex<_Tp> *__am = __a + __m * __stride_a;
+    const std::int64_t *__pm = __ipiv + __m * __stride_ipiv;
+    complex<_Tp> __d(1, 0);
+    for (std::size_t __k = 0; __k < _Np; ++__k) {
+      __d *= __am[__k + __k * __lda];
+      if (__pm[__k] != std::int64_t(__k + 1))
+        __d = -__d;
+    }
+    __det[__m] = __d;
+  });
+}
+
+// heev_batch
+//
+// One work-item per matrix, holding the whole matrix, and its eigenvectors
+// when requested, in private memory.
+
+enum class job { novec, vec };
+
+constexpr std::size_t __heev_max = 16;
+constexpr int __heev_max_sweeps = 32;
+
+// A = U^H * A * U and V = V * U for the unitary U that zeroes A(p, q):
+// with A(p, q) = |A(p, q)| e^(i phi) this is the real Jacobi rotation of
+// diag(1, e^(-i phi)) * A(p, q block) * diag(1, e^(i phi)).
+template <std::size_t _Np, class _Tp>
+_SYCL_EXT_CPLX_INLINE_VISIBILITY void
+__jacobi_rotate(complex<_Tp> (&__a)[_Np][_Np], complex<_Tp> (&__v)[_Np][_Np],
+                bool __vec, std::size_t __p, std::size_t __q) {
+  const complex<_Tp> __apq = __a[__p][__q];
+  const _Tp __mag = sycl::hypot(__apq.real(), __apq.imag());
+  if (__mag == _Tp(0))
+    return;
+  const complex<_Tp> __ph(__apq.real() / __mag, __apq.imag() / __mag);
+  const complex<_Tp> __ph_c(__ph.real(), -__ph.imag());
+  const _Tp __app = __a[__p][__p].real(), __aqq = __a[__q][__q].real();
+  const _Tp __theta = (__aqq - __app) / (2 * __mag);
+  _Tp __t = 1 / (sycl::fabs(__theta) + sycl::hypot(__theta, _Tp(1)));
+  if (__theta < 0)
+    __t = -__t;
+  const _Tp __c = 1 / sycl::hypot(__t, _Tp(1)), __s = __t * __c;
+
+  for (std::size_t __k = 0; __k < _Np; ++__k) {
+    const complex<_Tp> __kp = __a[__k][__p], __kq = __a[__k][__q];
+    __a[__k][__p] = __c * __kp - __s * (__ph_c * __kq);
+    __a[__k][__q] = __s * __kp + __c * (__ph_c * __kq);
+  }
+  for (std::size_t __k = 0; __k < _Np; ++__k) {
+    const complex<_Tp> __pk = __a[__p][__k], __qk = __a[__q][__k];
+    __a[__p][__k] = __c * __pk - __s * (__ph * __qk);
+    __a[__q][__k] = __s * __pk + __c * (__ph * __qk);
+  }
+  __a[__p][__q] = __a[__q][__p] = complex<_Tp>(0, 0);
+  __a[__p][__p] = complex<_Tp>(__app - __t * __mag, 0);
+  __a[__q][__q] = complex<_Tp>(__aqq + __t * __mag, 0);
+
+  if (__vec)
+    for (std::size_t __k = 0; __k < _Np; ++__k) {
+      const complex<_Tp> __kp = __v[__k][__p], __kq = __v[__k][__q];
+      __v[__k][__p] = __c * __kp - __s * (__ph_c * __kq);
+      __v[__k][__q] = __s * __kp + __c * (__ph_c * __kq);
+    }
+}
+
+// Cyclic sweeps until the off-diagonal part is negligible against the
+// Frobenius norm, which the rotations preserve.
+template <std::size_t _Np, class _Tp>
+_SYCL_EXT_CPLX_INLINE_VISIBILITY void
+__jacobi(complex<_Tp> (&__a)[_Np][_Np], complex<_Tp> (&__v)[_Np][_Np],
+         bool __vec) {
+  _Tp __total = 0;
+  for (std::size_t __i = 0; __i < _Np; ++__i)
+    for (std::size_t __j = 0; __j < _Np; ++__j)
+      __total += norm(__a[__i][__j]);
+  const _Tp __eps = std::numeric_limits<_Tp>::epsilon();
+  for (int __sweep = 0; __sweep < __heev_max_sweeps; ++__sweep) {
+    _Tp __off = 0;
+    for (std::size_t __p = 0; __p < _Np; ++__p)
+      for (std::size_t __q = __p + 1; __q < _Np; ++__q)
+        __off += norm(__a[__p][__q]);
+    if (__off <= __eps * __eps * __total)
+      break;
+    for (std::size_t __p = 0; __p < _Np; ++__p)
+      for (std::size_t __q = __p + 1; __q < _Np; ++__q)
+        __jacobi_rotate(__a, __v, __vec, __p, __q);
+  }
+}
+
+// Closed form for 3 x 3: the eigenvalues from the trigonometric solution of
+// the characteristic polynomial, and each eigenvector as the largest cross
+// product of two rows of A - lambda I. Returns false, leaving A alone, when
+// eigenvectors are wanted and two eigenvalues are too close for the cross
+// products to be accurate.
+template <class _Tp>
+_SYCL_EXT_CPLX_INLINE_VISIBILITY bool
+__heev3(complex<_Tp> (&__a)[3][3], complex<_Tp> (&__v)[3][3], bool __vec) {
+  const _Tp __a00 = __a[0][0].real(), __a11 = __a[1][1].real();
+  const _Tp __a22 = __a[2][2].real();
+  const complex<_Tp> __a01 = __a[0][1], __a02 = __a[0][2], __a12 = __a[1][2];
+  const _Tp __p1 = norm(__a01) + norm(__a02) + norm(__a12);
+  if (__p1 == _Tp(0))
+    return true; // already diagonal
+
+  const _Tp __q = (__a00 + __a11 + __a22) / 3;
+  const _Tp __d0 = __a00 - __q, __d1 = __a11 - __q, __d2 = __a22 - __q;
+  const _Tp __p2 = __d0 * __d0 + __d1 * __d1 + __d2 * __d2 + 2 * __p1;
+  const _Tp __p = sycl::sqrt(__p2 / 6);
+  // det((A - q I) / p) / 2
+  const _Tp __det =
+      __d0 * __d1 * __d2 + 2 * (__a01 * __a12 * conj(__a02)).real() -
+      __d0 * norm(__a12) - __d1 * norm(__a02) - __d2 * norm(__a01);
+  const _Tp __r = sycl::clamp(__det / (2 * __p * __p * __p), _Tp(-1), _Tp(1));
+  const _Tp __phi = sycl::acos(__r) / 3;
+  const _Tp __two_pi_3 = _Tp(2.0943951023931954923);
+  _Tp __w[3];
+  __w[2] = __q + 2 * __p * sycl::cos(__phi);
+  __w[0] = __q + 2 * __p * sycl::cos(__phi + __two_pi_3);
+  __w[1] = 3 * __q - __w[0] - __w[2];
+
+  if (__vec) {
+    const _Tp __scale = sycl::fmax(sycl::fabs(__w[0]), sycl::fabs(__w[2]));
+    const _Tp __gap = sycl::fmin(__w[1] - __w[0], __w[2] - __w[1]);
+    if (__gap <= sycl::sqrt(std::numeric_limits<_Tp>::epsilon()) * __scale)
+      return false;
+    for (std::size_t __k = 0; __k < 3; ++__k) {
+      complex<_Tp> __m[3][3];
+      for (std::size_t __i = 0; __i < 3; ++__i)
+        for (std::size_t __j = 0; __j < 3; ++__j)
+          __m[__i][__j] = __a[__i][__j];
+      for (std::size_t __i = 0; __i < 3; ++__i)
+        __m[__i][__i] -= __w[__k];
+      // Rows are orthogonal to the null vector without conjugation.
+      complex<_Tp> __best[3];
+      _Tp __best_norm = -1;
+      for (std::size_t __i = 0; __i < 3; ++__i) {
+        const complex<_Tp> *__x = __m[__i], *__y = __m[(__i + 1) % 3];
+        const complex<_Tp> __c[3] = {__x[1] * __y[2] - __x[2] * __y[1],
+                                     __x[2] * __y[0] - __x[0] * __y[2],
+                                     __x[0] * __y[1] - __x[1] * __y[0]};
+        const _Tp __n = norm(__c[0]) + norm(__c[1]) + norm(__c[2]);
+        if (__n > __best_norm) {
+          __best_norm = __n;
+          for (std::size_t __j = 0; __j < 3; ++__j)
+            __best[__j] = __c[__j];
+        }
+      }
+      const _Tp __inv = 1 / sycl::sqrt(__best_norm);
+      for (std::size_t __j = 0; __j < 3; ++__j)
+        __v[__j][__k] = __best[__j] * __inv;
+    }
+  }
+  for (std::size_t __i = 0; __i < 3; ++__i)
+    for (std::size_t __j = 0; __j < 3; ++__j)
+      __a[__i][__j] = complex<_Tp>(__i == __j ? __w[__i] : _Tp(0), 0);
+  return true;
+}
+
+template <std::size_t _Np, class _Tp>
+sycl::event heev_batch(sycl::queue &__q, job __jobz, complex<_Tp> *__a,
+                       std::size_t __lda, std::size_t __stride_a, _Tp *__w,
+                       std::size_t __stride_w, std::size_t __batch,
+                       const std::vector<sycl::event> &__deps = {}) {
+  __check_lapack_types<_Tp, _Np>();
+  static_assert(_Np <= __heev_max,
+                "heev_batch supports matrices up to 16 x 16");
+  const bool __vec = __jobz == job::vec;
+  return __blas_for_each(__q, __batch, __deps, [=](std::size_t __m) {
+    complex<_Tp> *__am = __a + __m * __stride_a;
+    complex<_Tp> __h[_Np][_Np], __v[_Np][_Np];
+    for (std::size_t __j = 0; __j < _Np; ++__j) {
+      for (std::size_t __i = 0; __i < __j; ++__i) {
+        __h[__i][__j] = __am[__i + __j * __lda];
+        __h[__j][__i] = conj(__h[__i][__j]);
+      }
+      __h[__j][__j] = complex<_Tp>(__am[__j + __j * __lda].real(), 0);
+      for (std::size_t __i = 0; __i < _Np; ++__i)
+        __v[__i][__j] = complex<_Tp>(__i == __j ? 1 : 0, 0);
+    }
+
+    if constexpr (_Np == 2) {
+      __jacobi_rotate(__h, __v, __vec, 0, 1);
+    } else if constexpr (_Np == 3) {
+      if (!__heev3(__h, __v, __vec))
+        __jacobi(__h, __v, __vec);
+    } else {
+      __jacobi(__h, __v, __vec);
+    }
+
+    // Selection sort into ascending order, eigenvectors alongside.
+    _Tp *__wm = __w + __m * __stride_w;
+    for (std::size_t __k = 0; __k < _Np; ++__k)
+      __wm[__k] = __h[__k][__k].real();
+    for (std::size_t __k = 0; __k < _Np; ++__k) {
+      std::size_t __min = __k;
+      for (std::size_t __j = __k + 1; __j < _Np; ++__j)
+        if (__wm[__j] < __wm[__min])
+          __min = __j;
+      if (__min == __k)
+        continue;
+      const _Tp __t = __wm[__k];
+      __wm[__k] = __wm[__min];
+      __wm[__min] = __t;
+      if (__vec)
+        for (std::size_t __i = 0; __i < _Np; ++__i) {
+          const complex<_Tp> __x = __v[__i][__k];
+          __v[__i][__k] = __v[__i][__min];
+          __v[__i][__min] = __x;
+        }
+    }
+
+    if (__vec)
+      for (std::size_t __j = 0; __j < _Np; ++__j)
+        for (std::size_t __i = 0; __i < _Np; ++__i)
+          __am[__i + __j * __lda] = __v[__i][__j];
+  });
+}
+
+_SYCL_EXT_CPLX_END_NAMESPACE_STD
+
+#undef _SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD
+#undef _SYCL_EXT_CPLX_END_NAMESPACE_STD
+#undef _SYCL_EXT_CPLX_INLINE_VISIBILITY
+
+#endif // _SYCL_EXT_CPLX_COMPLEX_LAPACK
@@ -0,0 +1,379 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the SyclCPLX project, under the Apache License v2.0 with LLVM
+// Exceptions. See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _SYCL_EXT_CPLX_COMPLEX_SPARSE
+#define _SYCL_EXT_CPLX_COMPLEX_SPARSE
+
+// clang-format off
+
+/*
+    sparse synopsis
+
+namespace sycl::ext::cplx
+{
+
+enum class spmv_algorithm { row_per_subgroup, merge_path };
+
+// y = alpha * op(A) * x + beta * y for a rows x cols sparse complex<T> USM
+// matrix A (T is float or double), where op(A) is A, its transpose or its
+// conjugate transpose. y is not read when beta is 0. The transposed forms
+// and merge_path accumulate into y with atomic_add, so for complex<double>
+// they throw sycl::exception with errc::feature_not_supported if the queue's
+// device lacks aspect::atomic64.
+
+// CSR: row i holds values[k] at column col_ind[k] for k in
+// [row_ptr[i], row_ptr[i + 1]), and nnz == row_ptr[rows]. row_per_subgroup
+// gives each row a sub-group; merge_path splits rows + nnz evenly between
+// work-items, for matrices with irregular rows.
+template<class T, class Index>
+  sycl::event csr_gemv(sycl::queue&, transpose trans, size_t rows,
+                       size_t cols, size_t nnz, complex<T> alpha,
+                       const Index* row_ptr, const Index* col_ind,
+                       const complex<T>* values, const complex<T>* x,
+                       complex<T> beta, complex<T>* y,
+                       spmv_algorithm alg = spmv_algorithm::row_per_subgroup,
+                       const std::vector<sycl::event>& deps = {});
+
+// ELLPACK: entry k of row i, for k < width, at col_ind[k * ld + i] and
+// values[k * ld + i], with ld >= rows. Padding entries have a negative column.
+template<class T, class Index>
+  sycl::event ell_gemv(sycl::queue&, transpose trans, size_t rows,
+                       size_t cols, size_t width, complex<T> alpha,
+                       const Index* col_ind, const complex<T>* values,
+                       size_t ld, const complex<T>* x, complex<T> beta,
+                       complex<T>* y,
+                       const std::vector<sycl::event>& deps = {});
+
+// Sliced ELLPACK: rows in slices of slice_size, slice s an ELLPACK block
+// with ld == slice_size starting at slice_ptr[s] and
+// (slice_ptr[s + 1] - slice_ptr[s]) / slice_size entries per row. Padding
+// entries have a negative column.
+template<class T, class Index>
+  sycl::event sell_gemv(sycl::queue&, transpose trans, size_t rows,
+                        size_t cols, size_t slice_size, complex<T> alpha,
+                        const Index* slice_ptr, const Index* col_ind,
+                        const complex<T>* values, const complex<T>* x,
+                        complex<T> beta, complex<T>* y,
+                        const std::vector<sycl::event>& deps = {});
+
+}  // sycl::ext::cplx
+
+*/
+
+// clang-format on
+
+#include "sycl_ext_complex.hpp"
+#include "sycl_ext_complex_algorithm.hpp"
+#include "sycl_ext_complex_atomic.hpp"
+#include "sycl_ext_complex_blas.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#define _SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD namespace sycl::ext::cplx {
+#define _SYCL_EXT_CPLX_END_NAMESPACE_STD }
+#define _SYCL_EXT_CPLX_INLINE_VISIBILITY                                       \
+  inline __attribute__((__visibility__("hidden"), __always_inline__))
+
+_SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD
+
+enum class spmv_algorithm { row_per_subgroup, merge_path };
+
+template <class _Tp, class _Index> constexpr void __check_spmv_types() {
+  static_assert(std::is_same_v<_Tp, float> || std::is_same_v<_Tp, double>,
+                "sparse gemv requires complex<float> or complex<double>");
+  static_assert(std::is_integral_v<_Index>, "sparse indices are integral");
+}
+
+template <class _Tp>
+_SYCL_EXT_CPLX_INLINE_VISIBILITY complex<_Tp> __conj_if(bool __conj,
+                                                        complex<_Tp> __v) {
+  return __conj ? complex<_Tp>(__v.real(), -__v.imag()) : __v;
+}
+
+// y = beta * y, ahead of the kernels that add into y.
+template <class _Tp>
+sycl::event __spmv_scale(sycl::queue &__q, std::size_t __n, complex<_Tp> __beta,
+                         complex<_Tp> *__y,
+                         const std::vector<sycl::event> &__deps) {
+  const bool __zero = __beta == complex<_Tp>(0, 0);
+  return __blas_for_each(__q, __n, __deps, [=](std::size_t __i) {
+    __y[__i] = __zero ? complex<_Tp>()
+                      : op::limited_range_multiplies(__beta, __y[__i]);
+  });
+}
+
+// csr_gemv, row_per_subgroup
+//
+// Sub-groups take rows in turn, their work-items striding along the row
+// together. Without transposition the row sums are reduced across the
+// sub-group; otherwise each work-item scatters its products into y.
+
+template <bool _Trans, class _Tp, class _Index>
+sycl::event __csr_rows(sycl::queue &__q, std::size_t __rows, bool __conj,
+                       complex<_Tp> __alpha, const _Index *__row_ptr,
+                       const _Index *__col_ind, const complex<_Tp> *__values,
+                       const complex<_Tp> *__x, complex<_Tp> __beta,
+                       complex<_Tp> *__y,
+                       const std::vector<sycl::event> &__deps) {
+  // Enough work-items for a sub-group of up to 32 per row.
+  const __launch_config __cfg =
+      __elementwise_config(__q.get_device(), __rows * 32);
+  return __q.submit([&](sycl::handler &__cgh) {
+    __cgh.depends_on(__deps);
+    __cgh.parallel_for(__cfg.__range(), [=](sycl::nd_item<1> __it) {
+      const auto __sg = __it.get_sub_group();
+      const std::size_t __lane = __sg.get_local_linear_id();
+      const std::size_t __lanes = __sg.get_local_linear_range();
+      const std::size_t __sgs = __sg.get_group_linear_range();
+      const std::size_t __stride = __it.get_group_range(0) * __sgs;
+      for (std::size_t __row =
+               __it.get_group(0) * __sgs + __sg.get_group_linear_id();
+           __row < __rows; __row += __stride) {
+        const std::size_t __begin = __row_ptr[__row];
+        const std::size_t __end = __row_ptr[__row + 1];
+        if constexpr (_Trans) {
+          const complex<_Tp> __ax =
+              op::limited_range_multiplies(__alpha, __x[__row]);
+          for (std::size_t __k = __begin + __lane; __k < __end; __k += __lanes)
+            atomic_add(__y[__col_ind[__k]],
+                       op::limited_range_multiplies(
+                           __conj_if(__conj, __values[__k]), __ax));
+        } else {
+          _Tp __re = 0, __im = 0;
+          for (std::size_t __k = __begin + __lane; __k < __end; __k += __lanes)
+            __fma_dot<false>(__values[__k], __x[__col_ind[__k]], __re, __im);
+          const sycl::plus<_Tp> __plus;
+          __re = sycl::reduce_over_group(__sg, __re, __plus);
+          __im = sycl::reduce_over_group(__sg, __im, __plus);
+          if (__lane == 0)
+            __y[__row] = __blas_update(__alpha, complex<_Tp>(__re, __im),
+                                       __beta, __y + __row);
+        }
+      }
+    });
+  });
+}
+
+// csr_gemv, merge_path
+//
+// The rows + nnz steps of merging the row ends row_ptr[1..rows] with the
+// nonzero positions 0..nnz-1 are split evenly between the work-items, each
+// finding its starting (row, nonzero) pair with a binary search along its
+// diagonal. A work-item that sees the whole of a row writes its result;
+// rows cut between work-items are accumulated with atomic_add into y, which
+// has already been scaled by beta.
+
+template <class _Index>
+_SYCL_EXT_CPLX_INLINE_VISIBILITY std::size_t
+__merge_path_search(std::size_t __d, const _Index *__row_ptr,
+                    std::size_t __rows, std::size_t __nnz) {
+  std::size_t __lo = __d > __nnz ? __d - __nnz : 0;
+  std::size_t __hi = __d < __rows ? __d : __rows;
+  while (__lo < __hi) {
+    const std::size_t __mid = (__lo + __hi) / 2;
+    if (std::size_t(__row_ptr[__mid + 1]) <= __d - 1 - __mid)
+      __lo = __mid + 1;
+    else
+      __hi = __mid;
+  }
+  return __lo;
+}
+
+template <bool _Trans, class _Tp, class _Index>
+sycl::event __csr_merge(sycl::queue &__q, std::size_t __rows, std::size_t __nnz,
+                        bool __conj, complex<_Tp> __alpha,
+                        const _Index *__row_ptr, const _Index *__col_ind,
+                        const complex<_Tp> *__values, const complex<_Tp> *__x,
+                        complex<_Tp> *__y,
+                        const std::vector<sycl::event> &__deps) {
+  const std::size_t __path = __rows + __nnz;
+  const __launch_config __cfg =
+      __elementwise_config(__q.get_device(), __path);
+  return __q.submit([&](sycl::handler &__cgh) {
+    __cgh.depends_on(__deps);
+    __cgh.parallel_for(__cfg.__range(), [=](sycl::nd_item<1> __it) {
+      const std::size_t __items = __it.get_global_range(0);
+      const std::size_t __chunk = (__path + __items - 1) / __items;
+      const std::size_t __d0 =
+          std::min(__it.get_global_id(0) * __chunk, __path);
+      const std::size_t __d1 = std::min(__d0 + __chunk, __path);
+
+      const std::size_t __row0 =
+          __merge_path_search(__d0, __row_ptr, __rows, __nnz);
+      const std::size_t __k0 = __d0 - __row0;
+      std::size_t __row = __row0, __k = __k0;
+      _Tp __re = 0, __im = 0;
+      complex<_Tp> __ax;
+      if constexpr (_Trans)
+        if (__row < __rows)
+          __ax = op::limited_range_multiplies(__alpha, __x[__row]);
+
+      for (std::size_t __d = __d0; __d < __d1; ++__d) {
+        if (__k < std::size_t(__row_ptr[__row + 1])) {
+          if constexpr (_Trans)
+            atomic_add(__y[__col_ind[__k]],
+                       op::limited_range_multiplies(
+                           __conj_if(__conj, __values[__k]), __ax));
+          else
+            __fma_dot<false>(__values[__k], __x[__col_ind[__k]], __re, __im);
+          ++__k;
+        } else {
+          if constexpr (!_Trans) {
+            const complex<_Tp> __v = op::limited_range_multiplies(
+                __alpha, complex<_Tp>(__re, __im));
+            const bool __whole =
+                __row != __row0 || __k0 == std::size_t(__row_ptr[__row]);
+            if (__whole)
+              __y[__row] += __v;
+            else
+              atomic_add(__y[__row], __v);
+            __re = __im = 0;
+          }
+          ++__row;
+          if constexpr (_Trans)
+            if (__row < __rows)
+              __ax = op::limited_range_multiplies(__alpha, __x[__row]);
+        }
+      }
+      // The row continues past this work-item.
+      if constexpr (!_Trans)
+        if (__row < __rows &&
+            __k > std::max<std::size_t>(__k0, __row_ptr[__row]))
+          atomic_add(__y[__row], op::limited_range_multiplies(
+                                     __alpha, complex<_Tp>(__re, __im)));
+    });
+  });
+}
+
+template <class _Tp, class _Index>
+sycl::event
+csr_gemv(sycl::queue &__q, transpose __trans, std::size_t __rows,
+         std::size_t __cols, std::size_t __nnz,
+         __blas_scalar_t<complex<_Tp>> __alpha, const _Index *__row_ptr,
+         const _Index *__col_ind, const complex<_Tp> *__values,
+         const complex<_Tp> *__x, __blas_scalar_t<complex<_Tp>> __beta,
+         complex<_Tp> *__y,
+         spmv_algorithm __alg = spmv_algorithm::row_per_subgroup,
+         const std::vector<sycl::event> &__deps = {}) {
+  __check_spmv_types<_Tp, _Index>();
+  const bool __conj = __trans == transpose::conjtrans;
+  if (__trans != transpose::nontrans || __alg == spmv_algorithm::merge_path)
+    __check_atomic_add<_Tp>(__q.get_device());
+  if (__trans != transpose::nontrans) {
+    sycl::event __e = __spmv_scale(__q, __cols, __beta, __y, __deps);
+    if (__alg == spmv_algorithm::merge_path)
+      return __csr_merge<true>(__q, __rows, __nnz, __conj, __alpha, __row_ptr,
+                               __col_ind, __values, __x, __y, {__e});
+    return __csr_rows<true>(__q, __rows, __conj, __alpha, __row_ptr,
+                            __col_ind, __values, __x, __beta, __y, {__e});
+  }
+  if (__alg == spmv_algorithm::merge_path) {
+    sycl::event __e = __spmv_scale(__q, __rows, __beta, __y, __deps);
+    return __csr_merge<false>(__q, __rows, __nnz, false, __alpha, __row_ptr,
+                              __col_ind, __values, __x, __y, {__e});
+  }
+  return __csr_rows<false>(__q, __rows, false, __alpha, __row_ptr, __col_ind,
+                           __values, __x, __beta, __y, __deps);
+}
+
+// ell_gemv, sell_gemv
+//
+// One work-item per row. Entries of neighbouring rows are adjacent, so the
+// loads are contiguous across work-items. __entries(row) gives the offset of
+// the first entry of the row, the number of entries and their spacing.
+
+struct __ell_entries {
+  std::size_t __first, __width, __ld;
+};
+
+template <class _Tp, class _Index, class _Entries>
+sycl::event __ell(sycl::queue &__q, transpose __trans, std::size_t __rows,
+                  std::size_t __cols, complex<_Tp> __alpha,
+                  const _Index *__col_ind, const complex<_Tp> *__values,
+                  const complex<_Tp> *__x, complex<_Tp> __beta,
+                  complex<_Tp> *__y, const std::vector<sycl::event> &__deps,
+                  _Entries __entries) {
+  __check_spmv_types<_Tp, _Index>();
+  static_assert(std::is_signed_v<_Index>,
+                "ELLPACK padding needs signed column indices");
+  if (__trans == transpose::nontrans)
+    return __blas_for_each(__q, __rows, __deps, [=](std::size_t __row) {
+      const auto [__first, __width, __ld] = __entries(__row);
+      _Tp __re = 0, __im = 0;
+      for (std::size_t __k = 0; __k < __width; ++__k) {
+        const _Index __col = __col_ind[__first + __k * __ld];
+        if (__col >= 0)
+          __fma_dot<false>(__values[__first + __k * __ld], __x[__col], __re,
+                           __im);
+      }
+      __y[__row] = __blas_update(__alpha, complex<_Tp>(__re, __im), __beta,
+                                 __y + __row);
+    });
+
+  const bool __conj = __trans == transpose::conjtrans;
+  __check_atomic_add<_Tp>(__q.get_device());
+  sycl::event __e = __spmv_scale(__q, __cols, __beta, __y, __deps);
+  return __blas_for_each(__q, __rows, {__e}, [=](std::size_t __row) {
+    const auto [__first, __width, __ld] = __entries(__row);
+    const complex<_Tp> __ax = op::limited_range_multiplies(__alpha, __x[__row]);
+    for (std::size_t __k = 0; __k < __width; ++__k) {
+      const _Index __col = __col_ind[__first + __k * __ld];
+      if (__col >= 0)
+        atomic_add(__y[__col],
+                   op::limited_range_multiplies(
+                       __conj_if(__conj, __values[__first + __k * __ld]),
+                       __ax));
+    }
+  });
+}
+
+template <class _Tp, class _Index>
+sycl::event ell_gemv(sycl::queue &__q, transpose __trans, std::size_t __rows,
+                     std::size_t __cols, std::size_t __width,
+                     __blas_scalar_t<complex<_Tp>> __alpha,
+                     const _Index *__col_ind, const complex<_Tp> *__values,
+                     std::size_t __ld, const complex<_Tp> *__x,
+                     __blas_scalar_t<complex<_Tp>> __beta, complex<_Tp> *__y,
+                     const std::vector<sycl::event> &__deps = {}) {
+  return __ell(__q, __trans, __rows, __cols, __alpha, __col_ind, __values, __x,
+               __beta, __y, __deps, [=](std::size_t __row) {
+                 return __ell_entries{__row, __width, __ld};
+               });
+}
+
+template <class _Tp, class _Index>
+sycl::event sell_gemv(sycl::queue &__q, transpose __trans, std::size_t __rows,
+                      std::size_t __cols, std::size_t __slice_size,
+                      __blas_scalar_t<complex<_Tp>> __alpha,
+                      const _Index *__slice_ptr, const _Index *__col_ind,
+                      const complex<_Tp> *__values, const complex<_Tp> *__x,
+                      __blas_scalar_t<complex<_Tp>> __beta, complex<_Tp> *__y,
+                      const std::vector<sycl::event> &__deps = {}) {
+  return __ell(__q, __trans, __rows, __cols, __alpha, __col_ind, __values, __x,
+               __beta, __y, __deps, [=](std::size_t __row) {
+                 const std::size_t __s = __row / __slice_size;
+                 const std::size_t __begin = __slice_ptr[__s];
+                 return __ell_entries{
+                     __begin + __row % __slice_size,
+                     (std::size_t(__slice_ptr[__s + 1]) - __begin) /
+                         __slice_size,
+                     __slice_size};
+               });
+}
+
+_SYCL_EXT_CPLX_END_NAMESPACE_STD
+
+#undef _SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD
+#undef _SYCL_EXT_CPLX_END_NAMESPACE_STD
+#undef _SYCL_EXT_CPLX_INLINE_VISIBILITY
+
+#endif // _SYCL_EXT_CPLX_COMPLEX_SPARSE
@@ -0,0 +1,323 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the SyclCPLX project, under the Apache License v2.0 with LLVM
+// Exceptions. See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _SYCL_EXT_CPLX_COMPLEX_TRANSPOSE
+#define _SYCL_EXT_CPLX_COMPLEX_TRANSPOSE
+
+// clang-format off
+
+/*
+    transpose synopsis
+
+namespace sycl::ext::cplx
+{
+
+// B = alpha * op(A) for a rows x cols complex<T> USM matrix A, in the given
+// layout. op(A) is A, its transpose or its conjugate transpose, so that B is
+// rows x cols or cols x rows.
+template<class T>
+  sycl::event omatcopy(sycl::queue&, layout, transpose trans, size_t rows,
+                       size_t cols, complex<T> alpha, const complex<T>* a,
+                       size_t lda, complex<T>* b, size_t ldb,
+                       const std::vector<sycl::event>& deps = {});
+
+// A = alpha * op(A) in place, with A read with leading dimension lda and
+// written with ldb. Square transposes with lda == ldb swap tiles in place,
+// other shapes go through a temporary copy.
+template<class T>
+  sycl::event imatcopy(sycl::queue&, layout, transpose trans, size_t rows,
+                       size_t cols, complex<T> alpha, complex<T>* ab,
+                       size_t lda, size_t ldb,
+                       const std::vector<sycl::event>& deps = {});
+
+// batch independent omatcopy, matrix i at a + i * stride_a and
+// b + i * stride_b.
+template<class T>
+  sycl::event omatcopy_batch(sycl::queue&, layout, transpose trans,
+                             size_t rows, size_t cols, complex<T> alpha,
+                             const complex<T>* a, size_t lda, size_t stride_a,
+                             complex<T>* b, size_t ldb, size_t stride_b,
+                             size_t batch,
+                             const std::vector<sycl::event>& deps = {});
+
+// batch independent imatcopy, matrix i at ab + i * stride.
+template<class T>
+  sycl::event imatcopy_batch(sycl::queue&, layout, transpose trans,
+                             size_t rows, size_t cols, complex<T> alpha,
+                             complex<T>* ab, size_t lda, size_t ldb,
+                             size_t stride, size_t batch,
+                             const std::vector<sycl::event>& deps = {});
+
+}  // sycl::ext::cplx
+
+*/
+
+// clang-format on
+
+#include "sycl_ext_complex.hpp"
+#include "sycl_ext_complex_algorithm.hpp"
+#include "sycl_ext_complex_blas.hpp"
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+#define _SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD namespace sycl::ext::cplx {
+#define _SYCL_EXT_CPLX_END_NAMESPACE_STD }
+#define _SYCL_EXT_CPLX_INLINE_VISIBILITY                                       \
+  inline __attribute__((__visibility__("hidden"), __always_inline__))
+
+_SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD
+
+// Below, matrices are handled as they sit in memory: rows of __c contiguous
+// elements, __ld apart. A column-major matrix is then its row-major
+// transpose, and transposing either is the same operation.
+//
+// Transposes go through __transpose_tile x __transpose_tile tiles of local
+// memory, padded by one column so that reading a tile column hits distinct
+// banks. Work-groups are __transpose_tile x __transpose_rows items, each
+// moving __transpose_tile / __transpose_rows elements, so that both the
+// loads from A and the stores to B are contiguous along the work-group.
+// alpha and the conjugation are applied on the store.
+
+constexpr std::size_t __transpose_tile = 32;
+constexpr std::size_t __transpose_rows = 8;
+
+template <class _Tp> struct __matcopy_op {
+  complex<_Tp> __alpha;
+  bool __conj;
+  bool __unit; // alpha == 1, which must leave infinities alone
+
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY complex<_Tp>
+  operator()(complex<_Tp> __v) const {
+    if (__conj)
+      __v = complex<_Tp>(__v.real(), -__v.imag());
+    return __unit ? __v : op::limited_range_multiplies(__alpha, __v);
+  }
+};
+
+template <class _Tp>
+_SYCL_EXT_CPLX_INLINE_VISIBILITY __matcopy_op<_Tp>
+__make_matcopy_op(complex<_Tp> __alpha, transpose __trans) {
+  return {__alpha, __trans == transpose::conjtrans,
+          __alpha == complex<_Tp>(1, 0)};
+}
+
+_SYCL_EXT_CPLX_INLINE_VISIBILITY sycl::nd_range<3>
+__transpose_range(std::size_t __batch, std::size_t __r, std::size_t __c) {
+  constexpr std::size_t __t = __transpose_tile, __h = __transpose_rows;
+  return sycl::nd_range<3>(
+      sycl::range<3>(__batch, (__r + __t - 1) / __t * __h,
+                     (__c + __t - 1) / __t * __t),
+      sycl::range<3>(1, __h, __t));
+}
+
+inline sycl::event __matcopy_empty(sycl::queue &__q,
+                                   const std::vector<sycl::event> &__deps) {
+  return __q.submit([&](sycl::handler &__cgh) {
+    __cgh.depends_on(__deps);
+    __cgh.single_task([=] {});
+  });
+}
+
+// B = f(A) with A and B __r x __c, or B = f(A)^T with B __c x __r.
+template <bool _Transpose, class _Tp>
+sycl::event __matcopy(sycl::queue &__q, std::size_t __r, std::size_t __c,
+                      __matcopy_op<_Tp> __f, const complex<_Tp> *__a,
+                      std::size_t __lda, std::size_t __stride_a,
+                      complex<_Tp> *__b, std::size_t __ldb,
+                      std::size_t __stride_b, std::size_t __batch,
+                      const std::vector<sycl::event> &__deps) {
+  constexpr std::size_t __t = __transpose_tile, __h = __transpose_rows;
+  if (__r == 0 || __c == 0 || __batch == 0)
+    return __matcopy_empty(__q, __deps);
+  return __q.submit([&](sycl::handler &__cgh) {
+    __cgh.depends_on(__deps);
+    sycl::local_accessor<complex<_Tp>, 1> __tile(
+        sycl::range<1>(_Transpose ? __t * (__t + 1) : 1), __cgh);
+    __cgh.parallel_for(
+        __transpose_range(__batch, __r, __c), [=](sycl::nd_item<3> __it) {
+          const std::size_t __m = __it.get_global_id(0);
+          const std::size_t __ly = __it.get_local_id(1);
+          const std::size_t __lx = __it.get_local_id(2);
+          const std::size_t __r0 = __it.get_group(1) * __t;
+          const std::size_t __c0 = __it.get_group(2) * __t;
+          const complex<_Tp> *__am = __a + __m * __stride_a;
+          complex<_Tp> *__bm = __b + __m * __stride_b;
+
+          if constexpr (!_Transpose) {
+            for (std::size_t __y = __ly; __y < __t; __y += __h)
+              if (__r0 + __y < __r && __c0 + __lx < __c)
+                __bm[(__r0 + __y) * __ldb + __c0 + __lx] =
+                    __f(__am[(__r0 + __y) * __lda + __c0 + __lx]);
+          } else {
+            for (std::size_t __y = __ly; __y < __t; __y += __h)
+              if (__r0 + __y < __r && __c0 + __lx < __c)
+                __tile[__y * (__t + 1) + __lx] =
+                    __am[(__r0 + __y) * __lda + __c0 + __lx];
+            sycl::group_barrier(__it.get_group());
+            for (std::size_t __y = __ly; __y < __t; __y += __h)
+              if (__c0 + __y < __c && __r0 + __lx < __r)
+                __bm[(__c0 + __y) * __ldb + __r0 + __lx] =
+                    __f(__tile[__lx * (__t + 1) + __y]);
+          }
+        });
+  });
+}
+
+// A = f(A)^T for square __n x __n matrices. The work-group of tile (i, j)
+// with i < j swaps it with tile (j, i), diagonal tiles transpose alone and
+// the remaining work-groups exit straight away.
+template <class _Tp>
+sycl::event __imatcopy_square(sycl::queue &__q, std::size_t __n,
+                              __matcopy_op<_Tp> __f, complex<_Tp> *__ab,
+                              std::size_t __ld, std::size_t __stride,
+                              std::size_t __batch,
+                              const std::vector<sycl::event> &__deps) {
+  constexpr std::size_t __t = __transpose_tile, __h = __transpose_rows;
+  constexpr std::size_t __pitch = __t + 1;
+  if (__n == 0 || __batch == 0)
+    return __matcopy_empty(__q, __deps);
+  return __q.submit([&](sycl::handler &__cgh) {
+    __cgh.depends_on(__deps);
+    sycl::local_accessor<complex<_Tp>, 1> __tiles(
+        sycl::range<1>(2 * __t * __pitch), __cgh);
+    __cgh.parallel_for(
+        __transpose_range(__batch, __n, __n), [=](sycl::nd_item<3> __it) {
+          const std::size_t __gi = __it.get_group(1);
+          const std::size_t __gj = __it.get_group(2);
+          if (__gi > __gj)
+            return;
+          const std::size_t __m = __it.get_global_id(0);
+          const std::size_t __ly = __it.get_local_id(1);
+          const std::size_t __lx = __it.get_local_id(2);
+          complex<_Tp> *__am = __ab + __m * __stride;
+          const bool __diagonal = __gi == __gj;
+          // Tile (__tr, __tc) in and out of local memory at __off.
+          const auto __load = [&](std::size_t __tr, std::size_t __tc,
+                                  std::size_t __off) {
+            for (std::size_t __y = __ly; __y < __t; __y += __h)
+              if (__tr * __t + __y < __n && __tc * __t + __lx < __n)
+                __tiles[__off + __y * __pitch + __lx] =
+                    __am[(__tr * __t + __y) * __ld + __tc * __t + __lx];
+          };
+          const auto __store = [&](std::size_t __tr, std::size_t __tc,
+                                   std::size_t __off) {
+            for (std::size_t __y = __ly; __y < __t; __y += __h)
+              if (__tr * __t + __y < __n && __tc * __t + __lx < __n)
+                __am[(__tr * __t + __y) * __ld + __tc * __t + __lx] =
+                    __f(__tiles[__off + __lx * __pitch + __y]);
+          };
+
+          __load(__gi, __gj, 0);
+          if (!__diagonal)
+            __load(__gj, __gi, __t * __pitch);
+          sycl::group_barrier(__it.get_group());
+          __store(__gj, __gi, 0);
+          if (!__diagonal)
+            __store(__gi, __gj, __t * __pitch);
+        });
+  });
+}
+
+// omatcopy
+
+template <class _Tp>
+sycl::event omatcopy_batch(sycl::queue &__q, layout __l, transpose __trans,
+                           std::size_t __rows, std::size_t __cols,
+                           __blas_scalar_t<complex<_Tp>> __alpha,
+                           const complex<_Tp> *__a, std::size_t __lda,
+                           std::size_t __stride_a, complex<_Tp> *__b,
+                           std::size_t __ldb, std::size_t __stride_b,
+                           std::size_t __batch,
+                           const std::vector<sycl::event> &__deps = {}) {
+  const bool __row_major = __l == layout::row_major;
+  const std::size_t __r = __row_major ? __rows : __cols;
+  const std::size_t __c = __row_major ? __cols : __rows;
+  const __matcopy_op<_Tp> __f = __make_matcopy_op(__alpha, __trans);
+  if (__trans == transpose::nontrans)
+    return __matcopy<false>(__q, __r, __c, __f, __a, __lda, __stride_a, __b,
+                            __ldb, __stride_b, __batch, __deps);
+  return __matcopy<true>(__q, __r, __c, __f, __a, __lda, __stride_a, __b,
+                         __ldb, __stride_b, __batch, __deps);
+}
+
+template <class _Tp>
+sycl::event omatcopy(sycl::queue &__q, layout __l, transpose __trans,
+                     std::size_t __rows, std::size_t __cols,
+                     __blas_scalar_t<complex<_Tp>> __alpha,
+                     const complex<_Tp> *__a, std::size_t __lda,
+                     complex<_Tp> *__b, std::size_t __ldb,
+                     const std::vector<sycl::event> &__deps = {}) {
+  return omatcopy_batch(__q, __l, __trans, __rows, __cols, __alpha, __a,
+                        __lda, 0, __b, __ldb, 0, 1, __deps);
+}
+
+// imatcopy
+
+template <class _Tp>
+sycl::event imatcopy_batch(sycl::queue &__q, layout __l, transpose __trans,
+                           std::size_t __rows, std::size_t __cols,
+                           __blas_scalar_t<complex<_Tp>> __alpha,
+                           complex<_Tp> *__ab, std::size_t __lda,
+                           std::size_t __ldb, std::size_t __stride,
+                           std::size_t __batch,
+                           const std::vector<sycl::event> &__deps = {}) {
+  const bool __row_major = __l == layout::row_major;
+  const std::size_t __r = __row_major ? __rows : __cols;
+  const std::size_t __c = __row_major ? __cols : __rows;
+  const __matcopy_op<_Tp> __f = __make_matcopy_op(__alpha, __trans);
+
+  if (__trans == transpose::nontrans && __lda == __ldb)
+    return __matcopy<false>(__q, __r, __c, __f, __ab, __lda, __stride, __ab,
+                            __ldb, __stride, __batch, __deps);
+  if (__trans != transpose::nontrans && __r == __c && __lda == __ldb)
+    return __imatcopy_square(__q, __r, __f, __ab, __lda, __stride, __batch,
+                             __deps);
+
+  // Otherwise elements move across each other's positions in ways that no
+  // tiling keeps apart, so go through a packed copy of the result.
+  if (__r == 0 || __c == 0 || __batch == 0)
+    return __matcopy_empty(__q, __deps);
+  const bool __t = __trans != transpose::nontrans;
+  const std::size_t __out_r = __t ? __c : __r, __out_c = __t ? __r : __c;
+  complex<_Tp> *__tmp =
+      sycl::malloc_device<complex<_Tp>>(__batch * __r * __c, __q);
+  if (!__tmp)
+    throw std::bad_alloc();
+  sycl::event __e =
+      __t ? __matcopy<true>(__q, __r, __c, __f, __ab, __lda, __stride, __tmp,
+                            __out_c, __out_r * __out_c, __batch, __deps)
+          : __matcopy<false>(__q, __r, __c, __f, __ab, __lda, __stride, __tmp,
+                             __out_c, __out_r * __out_c, __batch, __deps);
+  __e = __matcopy<false>(__q, __out_r, __out_c,
+                         __make_matcopy_op(complex<_Tp>(1, 0),
+                                           transpose::nontrans),
+                         __tmp, __out_c, __out_r * __out_c, __ab, __ldb,
+                         __stride, __batch, {__e});
+  return __free_after(__q, __e, __tmp);
+}
+
+template <class _Tp>
+sycl::event imatcopy(sycl::queue &__q, layout __l, transpose __trans,
+                     std::size_t __rows, std::size_t __cols,
+                     __blas_scalar_t<complex<_Tp>> __alpha,
+                     complex<_Tp> *__ab, std::size_t __lda, std::size_t __ldb,
+                     const std::vector<sycl::event> &__deps = {}) {
+  return imatcopy_batch(__q, __l, __trans, __rows, __cols, __alpha, __ab,
+                        __lda, __ldb, 0, 1, __deps);
+}
+
+_SYCL_EXT_CPLX_END_NAMESPACE_STD
+
+#undef _SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD
+#undef _SYCL_EXT_CPLX_END_NAMESPACE_STD
+#undef _SYCL_EXT_CPLX_INLINE_VISIBILITY
+
+#endif // _SYCL_EXT_CPLX_COMPLEX_TRANSPOSE
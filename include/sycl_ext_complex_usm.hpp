@@ -0,0 +1,289 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the SyclCPLX project, under the Apache License v2.0 with LLVM
+// Exceptions. See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _SYCL_EXT_CPLX_COMPLEX_USM
+#define _SYCL_EXT_CPLX_COMPLEX_USM
+
+// clang-format off
+
+/*
+    usm_pool synopsis
+
+namespace sycl::ext::cplx
+{
+
+struct usm_pool_stats
+{
+    size_t allocations;         // requests served
+    size_t deallocations;       // blocks returned
+    size_t cache_hits;          // requests served from a free list
+    size_t usm_allocations;     // calls to sycl::malloc
+    size_t bytes_in_use;        // bytes handed out and not yet returned
+    size_t bytes_cached;        // bytes held in free lists
+    size_t peak_bytes_in_use;
+};
+
+// Caching USM allocator for one queue and one kind of USM. Requests are
+// rounded up to a power-of-two size class starting at min_block bytes and
+// returned blocks are kept on a free list for that class, so repeated
+// allocations of the same size reuse memory instead of calling sycl::malloc.
+// Requests above max_block bytes bypass the free lists.
+//
+// A block may be handed out again as soon as it is deallocated, so work that
+// still uses it must be complete, or be ordered before later users of the
+// queue (for example by an in-order queue).
+//
+// usm_pool has reference semantics: copies share the same free lists.
+
+class usm_pool
+{
+public:
+    static constexpr size_t num_classes = 20;
+    static constexpr size_t min_block = 256;
+    static constexpr size_t max_block = min_block << (num_classes - 1);
+
+    explicit usm_pool(const sycl::queue& q,
+                      sycl::usm::alloc kind = sycl::usm::alloc::device);
+
+    void* allocate_bytes(size_t bytes);
+    void deallocate_bytes(void* p, size_t bytes);
+
+    template<class T> T* allocate(size_t n);
+    template<class T> void deallocate(T* p, size_t n);
+
+    void release();                 // frees every cached block
+    usm_pool_stats get_stats() const;
+
+    sycl::queue get_queue() const;
+    sycl::usm::alloc get_kind() const;
+};
+
+// std::allocator compatible allocator drawing from a usm_pool. Use it with
+// standard containers only for host accessible (shared or host) pools.
+template<class T>
+class usm_pool_allocator
+{
+public:
+    typedef T value_type;
+
+    usm_pool_allocator(const usm_pool&);
+    template<class U> usm_pool_allocator(const usm_pool_allocator<U>&);
+
+    T* allocate(size_t n);
+    void deallocate(T* p, size_t n);
+
+    usm_pool get_pool() const;
+};
+
+template<class T>
+  using complex_usm_allocator = usm_pool_allocator<complex<T>>;
+
+}  // sycl::ext::cplx
+
+*/
+
+// clang-format on
+
+#include "sycl_ext_complex.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#define _SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD namespace sycl::ext::cplx {
+#define _SYCL_EXT_CPLX_END_NAMESPACE_STD }
+
+_SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD
+
+struct usm_pool_stats {
+  std::size_t allocations = 0;
+  std::size_t deallocations = 0;
+  std::size_t cache_hits = 0;
+  std::size_t usm_allocations = 0;
+  std::size_t bytes_in_use = 0;
+  std::size_t bytes_cached = 0;
+  std::size_t peak_bytes_in_use = 0;
+};
+
+class usm_pool {
+public:
+  static constexpr std::size_t num_classes = 20;
+  static constexpr std::size_t min_block = 256;
+  static constexpr std::size_t max_block = min_block << (num_classes - 1);
+
+private:
+  struct __impl {
+    sycl::queue __q_;
+    sycl::usm::alloc __kind_;
+    mutable std::mutex __m_;
+    std::vector<void *> __free_[num_classes];
+    usm_pool_stats __stats_;
+
+    __impl(const sycl::queue &__q, sycl::usm::alloc __kind)
+        : __q_(__q), __kind_(__kind) {}
+    ~__impl() { __release(); }
+
+    void __release() {
+      for (auto &__list : __free_) {
+        for (void *__p : __list)
+          sycl::free(__p, __q_);
+        __list.clear();
+      }
+      __stats_.bytes_cached = 0;
+    }
+  };
+
+  std::shared_ptr<__impl> __impl_;
+
+  // Smallest class whose block holds __bytes, or num_classes if none does.
+  static std::size_t __size_class(std::size_t __bytes) {
+    std::size_t __c = 0;
+    while (__c < num_classes && (min_block << __c) < __bytes)
+      ++__c;
+    return __c;
+  }
+
+  // Byte size of __n objects of _Tp, throwing like std::allocator when it
+  // does not fit in size_t.
+  template <class _Tp> static std::size_t __array_bytes(std::size_t __n) {
+    if (__n > std::numeric_limits<std::size_t>::max() / sizeof(_Tp))
+      throw std::bad_array_new_length();
+    return __n * sizeof(_Tp);
+  }
+
+  void *__usm_malloc(std::size_t __bytes) {
+    void *__p = sycl::malloc(__bytes, __impl_->__q_, __impl_->__kind_);
+    if (!__p) {
+      // Give cached memory back to the runtime and try once more.
+      __impl_->__release();
+      __p = sycl::malloc(__bytes, __impl_->__q_, __impl_->__kind_);
+    }
+    if (!__p)
+      throw std::bad_alloc();
+    ++__impl_->__stats_.usm_allocations;
+    return __p;
+  }
+
+public:
+  explicit usm_pool(const sycl::queue &__q,
+                    sycl::usm::alloc __kind = sycl::usm::alloc::device)
+      : __impl_(std::make_shared<__impl>(__q, __kind)) {}
+
+  void *allocate_bytes(std::size_t __bytes) {
+    if (__bytes == 0)
+      return nullptr;
+    std::lock_guard<std::mutex> __lock(__impl_->__m_);
+    usm_pool_stats &__s = __impl_->__stats_;
+    const std::size_t __c = __size_class(__bytes);
+    const std::size_t __block = __c < num_classes ? min_block << __c : __bytes;
+    void *__p = nullptr;
+    if (__c < num_classes && !__impl_->__free_[__c].empty()) {
+      __p = __impl_->__free_[__c].back();
+      __impl_->__free_[__c].pop_back();
+      __s.bytes_cached -= __block;
+      ++__s.cache_hits;
+    } else {
+      __p = __usm_malloc(__block);
+    }
+    ++__s.allocations;
+    __s.bytes_in_use += __block;
+    if (__s.bytes_in_use > __s.peak_bytes_in_use)
+      __s.peak_bytes_in_use = __s.bytes_in_use;
+    return __p;
+  }
+
+  // __bytes must be the size passed to the matching allocate_bytes.
+  void deallocate_bytes(void *__p, std::size_t __bytes) {
+    if (!__p)
+      return;
+    std::lock_guard<std::mutex> __lock(__impl_->__m_);
+    usm_pool_stats &__s = __impl_->__stats_;
+    const std::size_t __c = __size_class(__bytes);
+    const std::size_t __block = __c < num_classes ? min_block << __c : __bytes;
+    if (__c < num_classes) {
+      __impl_->__free_[__c].push_back(__p);
+      __s.bytes_cached += __block;
+    } else {
+      sycl::free(__p, __impl_->__q_);
+    }
+    ++__s.deallocations;
+    __s.bytes_in_use -= __block;
+  }
+
+  template <class _Tp> _Tp *allocate(std::size_t __n) {
+    return static_cast<_Tp *>(allocate_bytes(__array_bytes<_Tp>(__n)));
+  }
+  template <class _Tp> void deallocate(_Tp *__p, std::size_t __n) {
+    deallocate_bytes(__p, __array_bytes<_Tp>(__n));
+  }
+
+  void release() {
+    std::lock_guard<std::mutex> __lock(__impl_->__m_);
+    __impl_->__release();
+  }
+
+  usm_pool_stats get_stats() const {
+    std::lock_guard<std::mutex> __lock(__impl_->__m_);
+    return __impl_->__stats_;
+  }
+
+  sycl::queue get_queue() const { return __impl_->__q_; }
+  sycl::usm::alloc get_kind() const { return __impl_->__kind_; }
+
+  friend bool operator==(const usm_pool &__x, const usm_pool &__y) {
+    return __x.__impl_ == __y.__impl_;
+  }
+  friend bool operator!=(const usm_pool &__x, const usm_pool &__y) {
+    return !(__x == __y);
+  }
+};
+
+template <class _Tp> class usm_pool_allocator {
+  usm_pool __pool_;
+
+public:
+  typedef _Tp value_type;
+  typedef std::true_type propagate_on_container_copy_assignment;
+  typedef std::true_type propagate_on_container_move_assignment;
+  typedef std::true_type propagate_on_container_swap;
+
+  usm_pool_allocator(const usm_pool &__pool) : __pool_(__pool) {}
+  template <class _Up>
+  usm_pool_allocator(const usm_pool_allocator<_Up> &__a)
+      : __pool_(__a.get_pool()) {}
+
+  _Tp *allocate(std::size_t __n) { return __pool_.allocate<_Tp>(__n); }
+  void deallocate(_Tp *__p, std::size_t __n) { __pool_.deallocate(__p, __n); }
+
+  usm_pool get_pool() const { return __pool_; }
+
+  template <class _Up>
+  friend bool operator==(const usm_pool_allocator &__x,
+                         const usm_pool_allocator<_Up> &__y) {
+    return __x.get_pool() == __y.get_pool();
+  }
+  template <class _Up>
+  friend bool operator!=(const usm_pool_allocator &__x,
+                         const usm_pool_allocator<_Up> &__y) {
+    return !(__x == __y);
+  }
+};
+
+template <class _Tp>
+using complex_usm_allocator = usm_pool_allocator<complex<_Tp>>;
+
+_SYCL_EXT_CPLX_END_NAMESPACE_STD
+
+#undef _SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD
+#undef _SYCL_EXT_CPLX_END_NAMESPACE_STD
+
+#endif // _SYCL_EXT_CPLX_COMPLEX_USM
@@ -0,0 +1,334 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Part of the SyclCPLX project, under the Apache License v2.0 with LLVM
+// Exceptions. See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _SYCL_EXT_CPLX_COMPLEX_VIEW
+#define _SYCL_EXT_CPLX_COMPLEX_VIEW
+
+// clang-format off
+
+/*
+    complex_view synopsis
+
+namespace sycl::ext::cplx
+{
+
+// Non-owning strided view of complex<T> elements, in the spirit of mdspan.
+// The view is trivially copyable and can be captured by value in kernels.
+// When Conj is true every read returns the conjugate of the stored value.
+
+template<class T, size_t Rank, bool Conj = false>
+class complex_view
+{
+public:
+    typedef complex<T> value_type;
+    typedef complex<T>& reference;         // value_type when Conj is true
+    typedef size_t      size_type;
+    typedef ptrdiff_t   difference_type;
+
+    static constexpr size_t rank();
+    static constexpr bool is_conjugated();
+
+    complex_view();
+    complex_view(complex<T>* data, const array<size_t, Rank>& extents);
+    complex_view(complex<T>* data, const array<size_t, Rank>& extents,
+                 const array<ptrdiff_t, Rank>& strides);
+
+    complex<T>* data() const;
+    size_t extent(size_t dim) const;
+    ptrdiff_t stride(size_t dim) const;
+    size_t size() const;
+    bool empty() const;
+    bool is_contiguous() const;
+    sycl::range<Rank> get_range() const;   // Rank <= 3
+
+    template<class... Idx> reference operator()(Idx... idx) const;
+    reference operator[](const array<size_t, Rank>& idx) const;
+    reference operator[](sycl::id<Rank> idx) const;    // Rank <= 3
+    reference operator[](sycl::item<Rank> idx) const;  // Rank <= 3
+
+    complex_view slice(size_t dim, size_t first, size_t count,
+                       ptrdiff_t step = 1) const;
+    complex_view subview(const array<size_t, Rank>& offsets,
+                         const array<size_t, Rank>& extents) const;
+    complex_view<T, Rank - 1, Conj> select(size_t dim, size_t index) const;
+    complex_view reverse(size_t dim) const;
+    complex_view permute(const array<size_t, Rank>& axes) const;
+    complex_view transpose() const;                     // Rank == 2
+    complex_view<T, Rank, !Conj> conj() const;
+};
+
+template<class T, size_t Rank, bool Conj>
+  complex_view<T, Rank, !Conj> conj(const complex_view<T, Rank, Conj>&);
+
+template<class T, class... Extents>
+  complex_view<T, sizeof...(Extents)> make_complex_view(complex<T>*, Extents...);
+template<class T, class... Extents>
+  complex_view<T, sizeof...(Extents)> make_complex_view(std::complex<T>*, Extents...);
+
+}  // sycl::ext::cplx
+
+*/
+
+// clang-format on
+
+#include "sycl_ext_complex.hpp"
+
+#include <array>
+#include <cstddef>
+
+#define _SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD namespace sycl::ext::cplx {
+#define _SYCL_EXT_CPLX_END_NAMESPACE_STD }
+#define _SYCL_EXT_CPLX_INLINE_VISIBILITY                                       \
+  inline __attribute__((__visibility__("hidden"), __always_inline__))
+
+_SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD
+
+template <class _Tp, std::size_t _Rank, bool _Conj = false>
+class complex_view {
+  static_assert(_Rank > 0, "complex_view requires a rank of at least one");
+  static_assert(is_genfloat<_Tp>::value,
+                "complex_view requires a sycl::half, float or double value");
+
+public:
+  typedef complex<_Tp> value_type;
+  typedef std::conditional_t<_Conj, complex<_Tp>, complex<_Tp> &> reference;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef std::array<size_type, _Rank> extents_type;
+  typedef std::array<difference_type, _Rank> strides_type;
+
+private:
+  complex<_Tp> *__data_;
+  extents_type __extents_;
+  strides_type __strides_;
+
+  template <class, std::size_t, bool> friend class complex_view;
+
+  static strides_type __packed_strides(const extents_type &__e) {
+    strides_type __s;
+    difference_type __acc = 1;
+    for (std::size_t __d = _Rank; __d-- > 0;) {
+      __s[__d] = __acc;
+      __acc *= static_cast<difference_type>(__e[__d]);
+    }
+    return __s;
+  }
+
+  template <class _Index>
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY difference_type
+  __offset(const _Index &__idx) const {
+    difference_type __off = 0;
+    for (std::size_t __d = 0; __d < _Rank; ++__d)
+      __off += static_cast<difference_type>(__idx[__d]) * __strides_[__d];
+    return __off;
+  }
+
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY reference
+  __at(difference_type __off) const {
+    if constexpr (_Conj)
+      return sycl::ext::cplx::conj(__data_[__off]);
+    else
+      return __data_[__off];
+  }
+
+public:
+  static constexpr std::size_t rank() { return _Rank; }
+  static constexpr bool is_conjugated() { return _Conj; }
+
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY constexpr complex_view()
+      : __data_(nullptr), __extents_{}, __strides_{} {}
+
+  // Row-major (C order) view over a contiguous allocation.
+  complex_view(complex<_Tp> *__data, const extents_type &__extents)
+      : __data_(__data), __extents_(__extents),
+        __strides_(__packed_strides(__extents)) {}
+
+  // Strides are in elements and may be negative.
+  complex_view(complex<_Tp> *__data, const extents_type &__extents,
+               const strides_type &__strides)
+      : __data_(__data), __extents_(__extents), __strides_(__strides) {}
+
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY complex<_Tp> *data() const {
+    return __data_;
+  }
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY size_type extent(std::size_t __d) const {
+    return __extents_[__d];
+  }
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY difference_type
+  stride(std::size_t __d) const {
+    return __strides_[__d];
+  }
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY const extents_type &extents() const {
+    return __extents_;
+  }
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY const strides_type &strides() const {
+    return __strides_;
+  }
+
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY size_type size() const {
+    size_type __n = 1;
+    for (std::size_t __d = 0; __d < _Rank; ++__d)
+      __n *= __extents_[__d];
+    return __n;
+  }
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY bool empty() const { return size() == 0; }
+
+  // True when the elements are packed in row-major order, so that data()[i]
+  // for i in [0, size()) visits every element exactly once.
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY bool is_contiguous() const {
+    difference_type __acc = 1;
+    for (std::size_t __d = _Rank; __d-- > 0;) {
+      if (__extents_[__d] != 1 && __strides_[__d] != __acc)
+        return false;
+      __acc *= static_cast<difference_type>(__extents_[__d]);
+    }
+    return true;
+  }
+
+  template <std::size_t _Rp = _Rank,
+            class = std::enable_if_t<(_Rp >= 1 && _Rp <= 3)>>
+  sycl::range<_Rp> get_range() const {
+    if constexpr (_Rp == 1)
+      return sycl::range<1>(__extents_[0]);
+    else if constexpr (_Rp == 2)
+      return sycl::range<2>(__extents_[0], __extents_[1]);
+    else
+      return sycl::range<3>(__extents_[0], __extents_[1], __extents_[2]);
+  }
+
+  // Element access
+
+  template <class... _Idx,
+            class = std::enable_if_t<sizeof...(_Idx) == _Rank &&
+                                     (std::is_integral_v<_Idx> && ...)>>
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY reference operator()(_Idx... __idx) const {
+    const size_type __i[_Rank] = {static_cast<size_type>(__idx)...};
+    return __at(__offset(__i));
+  }
+
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY reference
+  operator[](const extents_type &__idx) const {
+    return __at(__offset(__idx));
+  }
+
+  template <int _Dims, class = std::enable_if_t<_Dims == int(_Rank)>>
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY reference
+  operator[](sycl::id<_Dims> __idx) const {
+    return __at(__offset(__idx));
+  }
+
+  template <int _Dims, bool _WithOffset,
+            class = std::enable_if_t<_Dims == int(_Rank)>>
+  _SYCL_EXT_CPLX_INLINE_VISIBILITY reference
+  operator[](sycl::item<_Dims, _WithOffset> __idx) const {
+    return __at(__offset(__idx.get_id()));
+  }
+
+  // Views
+
+  // Elements [first, first + count * step) of dimension dim, every step-th.
+  complex_view slice(std::size_t __dim, size_type __first, size_type __count,
+                     difference_type __step = 1) const {
+    complex_view __v(*this);
+    __v.__data_ += static_cast<difference_type>(__first) * __strides_[__dim];
+    __v.__extents_[__dim] = __count;
+    __v.__strides_[__dim] = __strides_[__dim] * __step;
+    return __v;
+  }
+
+  complex_view subview(const extents_type &__offsets,
+                       const extents_type &__extents) const {
+    complex_view __v(*this);
+    __v.__data_ += __offset(__offsets);
+    __v.__extents_ = __extents;
+    return __v;
+  }
+
+  // Fixes dimension dim at index, dropping it from the view.
+  template <std::size_t _Rp = _Rank, class = std::enable_if_t<(_Rp > 1)>>
+  complex_view<_Tp, _Rank - 1, _Conj> select(std::size_t __dim,
+                                             size_type __index) const {
+    complex_view<_Tp, _Rank - 1, _Conj> __v;
+    __v.__data_ =
+        __data_ + static_cast<difference_type>(__index) * __strides_[__dim];
+    for (std::size_t __d = 0, __o = 0; __d < _Rank; ++__d) {
+      if (__d == __dim)
+        continue;
+      __v.__extents_[__o] = __extents_[__d];
+      __v.__strides_[__o] = __strides_[__d];
+      ++__o;
+    }
+    return __v;
+  }
+
+  complex_view reverse(std::size_t __dim) const {
+    complex_view __v(*this);
+    if (__extents_[__dim] != 0)
+      __v.__data_ += static_cast<difference_type>(__extents_[__dim] - 1) *
+                     __strides_[__dim];
+    __v.__strides_[__dim] = -__strides_[__dim];
+    return __v;
+  }
+
+  // Dimension d of the result is dimension axes[d] of this view.
+  complex_view permute(const extents_type &__axes) const {
+    complex_view __v(*this);
+    for (std::size_t __d = 0; __d < _Rank; ++__d) {
+      __v.__extents_[__d] = __extents_[__axes[__d]];
+      __v.__strides_[__d] = __strides_[__axes[__d]];
+    }
+    return __v;
+  }
+
+  template <std::size_t _Rp = _Rank, class = std::enable_if_t<_Rp == 2>>
+  complex_view transpose() const {
+    return permute({1, 0});
+  }
+
+  complex_view<_Tp, _Rank, !_Conj> conj() const {
+    return complex_view<_Tp, _Rank, !_Conj>(__data_, __extents_, __strides_);
+  }
+};
+
+template <class _Tp, std::size_t _Rank, bool _Conj>
+complex_view<_Tp, _Rank, !_Conj>
+conj(const complex_view<_Tp, _Rank, _Conj> &__v) {
+  return __v.conj();
+}
+
+// Hermitian (conjugate) transpose of a matrix view.
+template <class _Tp, bool _Conj>
+complex_view<_Tp, 2, !_Conj>
+conj_transpose(const complex_view<_Tp, 2, _Conj> &__v) {
+  return __v.transpose().conj();
+}
+
+template <class _Tp, class... _Extents,
+          class = std::enable_if_t<(std::is_integral_v<_Extents> && ...)>>
+complex_view<_Tp, sizeof...(_Extents)>
+make_complex_view(complex<_Tp> *__data, _Extents... __extents) {
+  return complex_view<_Tp, sizeof...(_Extents)>(
+      __data, {static_cast<std::size_t>(__extents)...});
+}
+
+// Views std::complex storage in place, see as_cplx.
+template <class _Tp, class... _Extents,
+          class = std::enable_if_t<(std::is_integral_v<_Extents> && ...)>>
+complex_view<_Tp, sizeof...(_Extents)>
+make_complex_view(std::complex<_Tp> *__data, _Extents... __extents) {
+  return make_complex_view(as_cplx(__data), __extents...);
+}
+
+_SYCL_EXT_CPLX_END_NAMESPACE_STD
+
+#undef _SYCL_EXT_CPLX_BEGIN_NAMESPACE_STD
+#undef _SYCL_EXT_CPLX_END_NAMESPACE_STD
+#undef _SYCL_EXT_CPLX_INLINE_VISIBILITY
+
+#endif // _SYCL_EXT_CPLX_COMPLEX_VIEW
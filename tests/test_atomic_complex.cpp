@@ -0,0 +1,135 @@
+#include "test_helper.hpp"
+
+#include "sycl_ext_complex_atomic.hpp"
+
+#include <type_traits>
+
+using namespace sycl::ext::cplx;
+
+template <typename T> struct test_atomic_add {
+  bool operator()(sycl::queue &Q, T init_re, T init_im) {
+    // SYCL has no atomic operations on half
+    if constexpr (std::is_same_v<T, sycl::half>) {
+      return true;
+    } else {
+      if (std::is_same_v<T, double> &&
+          !Q.get_device().has(sycl::aspect::atomic64))
+        return true;
+      bool pass = true;
+      constexpr std::size_t n = 256;
+
+      auto *acc = sycl::malloc_shared<complex<T>>(1, Q);
+      *acc = complex<T>(0, 0);
+
+      Q.parallel_for(sycl::nd_range<1>(n, 64), [=](sycl::nd_item<1>) {
+         atomic_add(*acc, complex<T>(init_re, init_im));
+       }).wait();
+
+      std::complex<T> std_out(T(n) * init_re, T(n) * init_im);
+      pass &= check_results(*acc, std_out, /*is_device*/ true);
+
+      sycl::free(acc, Q);
+
+      return pass;
+    }
+  }
+};
+
+template <typename T> struct test_atomic_fetch_add {
+  bool operator()(sycl::queue &Q, T init_re, T) {
+    // The paired update is only provided for complex<float>
+    if constexpr (!std::is_same_v<T, float>) {
+      return true;
+    } else {
+      if (!Q.get_device().has(sycl::aspect::atomic64))
+        return true;
+      bool pass = true;
+      constexpr std::size_t n = 256;
+
+      auto *acc = sycl::malloc_shared<complex<T>>(1, Q);
+      auto *prev = sycl::malloc_shared<complex<T>>(n, Q);
+      *acc = complex<T>(0, 0);
+
+      Q.parallel_for(sycl::nd_range<1>(n, 64), [=](sycl::nd_item<1> it) {
+         prev[it.get_global_id(0)] =
+             atomic_fetch_add(*acc, complex<T>(init_re, -init_re));
+       }).wait();
+
+      std::complex<T> std_out(T(n) * init_re, -T(n) * init_re);
+      pass &= check_results(*acc, std_out, /*is_device*/ true);
+
+      // Both parts are updated together, so every value observed by a
+      // work-item is one of the partial sums.
+      for (std::size_t i = 0; i < n; ++i) {
+        std_out = std::complex<T>(prev[i].real(), -prev[i].real());
+        pass &= check_results(prev[i], std_out, /*is_device*/ true);
+      }
+
+      sycl::free(acc, Q);
+      sycl::free(prev, Q);
+
+      return pass;
+    }
+  }
+};
+
+template <typename T> struct test_scatter_add {
+  bool operator()(sycl::queue &Q, T init_re, T init_im) {
+    if constexpr (std::is_same_v<T, sycl::half>) {
+      return true;
+    } else {
+      bool pass = true;
+      constexpr std::size_t n = 1000;
+      constexpr std::size_t bins = 7;
+
+      auto *values = sycl::malloc_shared<complex<T>>(n, Q);
+      auto *index = sycl::malloc_shared<int>(n, Q);
+      auto *grid = sycl::malloc_shared<complex<T>>(bins, Q);
+      std::complex<T> std_grid[bins] = {};
+      for (std::size_t i = 0; i < n; ++i) {
+        values[i] = complex<T>(init_re * T(i % 3), init_im);
+        index[i] = int((i * 5) % bins);
+        std_grid[index[i]] += std::complex<T>(init_re * T(i % 3), init_im);
+      }
+      for (std::size_t b = 0; b < bins; ++b)
+        grid[b] = complex<T>(0, 0);
+
+      if (std::is_same_v<T, double> &&
+          !Q.get_device().has(sycl::aspect::atomic64)) {
+        // Rejected on the host instead of failing in the kernel
+        bool thrown = false;
+        try {
+          scatter_add(Q, values, index, n, grid);
+        } catch (const sycl::exception &e) {
+          thrown = e.code() ==
+                   sycl::make_error_code(sycl::errc::feature_not_supported);
+        }
+        pass &= thrown;
+      } else {
+        scatter_add(Q, values, index, n, grid).wait();
+        for (std::size_t b = 0; b < bins; ++b)
+          pass &= check_results(grid[b], std_grid[b], /*is_device*/ true);
+      }
+
+      sycl::free(values, Q);
+      sycl::free(index, Q);
+      sycl::free(grid, Q);
+
+      return pass;
+    }
+  }
+};
+
+int main() {
+  sycl::queue Q;
+
+  bool test_passes = true;
+  test_passes &= test_valid_types<test_atomic_add>(Q, 1.0, 2.0);
+  test_passes &= test_valid_types<test_atomic_fetch_add>(Q, 0.5, 0.0);
+  test_passes &= test_valid_types<test_scatter_add>(Q, 1.0, -0.5);
+
+  if (!test_passes)
+    std::cerr << "atomic complex test fails\n";
+
+  return !test_passes;
+}
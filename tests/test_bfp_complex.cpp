@@ -0,0 +1,142 @@
+#include "test_helper.hpp"
+
+#include "sycl_ext_complex_bfp.hpp"
+
+using namespace sycl::ext::cplx;
+
+static_assert(std::is_trivially_copyable_v<bfp_complex_view<float>>);
+static_assert(bfp_complex_view<float, std::int8_t, 32>::storage_bytes(64) ==
+              64 * 2 + 2);
+static_assert(bfp_complex_view<float, std::int16_t, 16>::storage_bytes(40) ==
+              40 * 4 + 3);
+
+template <typename T, typename Mant, std::size_t Block>
+bool test_round_trip(sycl::queue &Q, std::size_t n) {
+  bool pass = true;
+  typedef bfp_complex_view<T, Mant, Block> view_t;
+
+  auto *in = sycl::malloc_shared<complex<T>>(n, Q);
+  auto *out = sycl::malloc_shared<complex<T>>(n, Q);
+  auto *sum = sycl::malloc_shared<complex<T>>(1, Q);
+  auto *mant = sycl::malloc_shared<typename view_t::mantissa_type>(n, Q);
+  auto *expo = sycl::malloc_shared<typename view_t::exponent_type>(
+      view_t::exponent_count(n), Q);
+
+  // Blocks with very different magnitudes, including an all-zero block
+  for (std::size_t i = 0; i < n; ++i) {
+    T mag = T(std::ldexp(1.0f, int(i / Block) * 5 - 10));
+    if (i / Block == 1)
+      mag = T(0);
+    in[i] = complex<T>(mag * T(std::sin(0.3 * i)), mag * T(std::cos(0.7 * i)));
+  }
+
+  view_t bfp(mant, expo, n);
+  auto e = bfp_compress(Q, in, bfp, {});
+  bfp_decompress(Q, bfp, out, {e}).wait();
+
+  // Each component is within one mantissa step of the block maximum
+  for (std::size_t b = 0; b < view_t::exponent_count(n); ++b) {
+    float max_c = 0;
+    for (std::size_t i = b * Block; i < std::min(n, (b + 1) * Block); ++i)
+      max_c = std::max({max_c, std::abs(float(in[i].real())),
+                        std::abs(float(in[i].imag()))});
+    float bound =
+        std::ldexp(max_c, -std::numeric_limits<Mant>::digits) * 1.0001f;
+    for (std::size_t i = b * Block; i < std::min(n, (b + 1) * Block); ++i) {
+      if (std::abs(float(out[i].real()) - float(in[i].real())) > bound ||
+          std::abs(float(out[i].imag()) - float(in[i].imag())) > bound) {
+        std::cerr << "bfp round trip fails for " << get_typename<T>()
+                  << " at " << i << ": " << out[i] << " vs " << in[i]
+                  << std::endl;
+        pass = false;
+      }
+    }
+  }
+
+  // Streaming iterators decompress inside a kernel
+  Q.single_task([=]() {
+     complex<T> acc;
+     for (auto it = bfp.begin(); it != bfp.end(); ++it)
+       acc += *it;
+     sum[0] = acc;
+   }).wait();
+
+  complex<T> ref;
+  for (std::size_t i = 0; i < n; ++i)
+    ref += out[i];
+  pass &= sum[0] == ref;
+
+  sycl::free(in, Q);
+  sycl::free(out, Q);
+  sycl::free(sum, Q);
+  sycl::free(mant, Q);
+  sycl::free(expo, Q);
+
+  return pass;
+}
+
+// Exponents are clamped to [-128, 127]: tiny blocks keep an absolute error
+// of one mantissa step at 2^-128 and huge blocks saturate.
+bool test_exponent_range(sycl::queue &Q) {
+  bool pass = true;
+  typedef bfp_complex_view<double, std::int16_t, 4> view_t;
+  constexpr std::size_t n = 12;
+  const int scales[] = {126, -200, 200};
+
+  auto *in = sycl::malloc_shared<complex<double>>(n, Q);
+  auto *out = sycl::malloc_shared<complex<double>>(n, Q);
+  auto *mant = sycl::malloc_shared<view_t::mantissa_type>(n, Q);
+  auto *expo = sycl::malloc_shared<view_t::exponent_type>(
+      view_t::exponent_count(n), Q);
+  for (std::size_t i = 0; i < n; ++i)
+    in[i] = complex<double>(std::ldexp(0.75, scales[i / 4]),
+                            -std::ldexp(0.25 * double(i % 4), scales[i / 4]));
+
+  view_t bfp(mant, expo, n);
+  auto e = bfp_compress(Q, in, bfp, {});
+  bfp_decompress(Q, bfp, out, {e}).wait();
+
+  const int digits = std::numeric_limits<std::int16_t>::digits;
+  for (std::size_t i = 0; i < 4; ++i) {
+    const double bound = std::ldexp(0.75, 126 - digits) * 1.0001;
+    pass &= std::abs(out[i].real() - in[i].real()) <= bound &&
+            std::abs(out[i].imag() - in[i].imag()) <= bound;
+  }
+  for (std::size_t i = 4; i < 8; ++i) {
+    const double bound = std::ldexp(1.0, -128 - digits);
+    pass &= std::abs(out[i].real() - in[i].real()) <= bound &&
+            std::abs(out[i].imag() - in[i].imag()) <= bound;
+  }
+  for (std::size_t i = 8; i < 12; ++i)
+    pass &= std::abs(out[i].real()) <= std::ldexp(1.0, 127) &&
+            std::abs(out[i].imag()) <= std::ldexp(1.0, 127);
+  pass &= std::abs(out[8].real()) > std::ldexp(1.0, 126);
+
+  if (!pass)
+    std::cerr << "bfp exponent range test fails" << std::endl;
+
+  sycl::free(in, Q);
+  sycl::free(out, Q);
+  sycl::free(mant, Q);
+  sycl::free(expo, Q);
+
+  return pass;
+}
+
+int main() {
+  sycl::queue Q;
+
+  bool test_passes = true;
+  test_passes &= test_round_trip<float, std::int8_t, 32>(Q, 100);
+  test_passes &= test_round_trip<float, std::int16_t, 16>(Q, 64);
+  test_passes &= test_round_trip<double, std::int16_t, 8>(Q, 37);
+  test_passes &= test_round_trip<sycl::half, std::int8_t, 8>(Q, 24);
+  // Blocks larger than common work-group size limits
+  test_passes &= test_round_trip<float, std::int16_t, 1024>(Q, 2500);
+  test_passes &= test_exponent_range(Q);
+
+  if (!test_passes)
+    std::cerr << "bfp complex test fails\n";
+
+  return !test_passes;
+}
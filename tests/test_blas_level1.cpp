@@ -0,0 +1,125 @@
+#include "test_helper.hpp"
+
+#include "sycl_ext_complex_blas.hpp"
+
+#include <limits>
+
+using namespace sycl::ext::cplx;
+
+// Inputs are small integers, so every result below is exact
+template <typename T> std::complex<T> x_input(std::size_t i) {
+  return std::complex<T>(T(i % 5), -T(i % 3));
+}
+template <typename T> std::complex<T> y_input(std::size_t i) {
+  return std::complex<T>(T(1) - T(i % 2), T(i % 4));
+}
+
+template <typename T> struct test_blas_level1 {
+  bool operator()(sycl::queue &Q, T init_re, T init_im) {
+    bool pass = true;
+    constexpr std::size_t n = 100;
+
+    // x has unit stride, y has stride 2 and is walked backwards in places
+    auto *x = sycl::malloc_shared<complex<T>>(n, Q);
+    auto *y = sycl::malloc_shared<complex<T>>(2 * n, Q);
+    auto *w = sycl::malloc_shared<complex<T>>(n, Q);
+    auto reset = [&] {
+      for (std::size_t i = 0; i < n; ++i) {
+        x[i] = x_input<T>(i);
+        y[2 * i] = y_input<T>(i);
+        y[2 * i + 1] = complex<T>(-7, -7);
+      }
+    };
+    auto check = [&](complex<T> *v, std::ptrdiff_t inc, auto expected) {
+      for (std::size_t i = 0; i < n; ++i) {
+        std::complex<T> std_out{};
+        std_out = expected(i);
+        pass &= check_results(v[i * inc], std_out, /*is_device*/ true);
+      }
+    };
+    const complex<T> a(init_re, init_im), b(init_im, 1);
+    const std::complex<T> alpha(init_re, init_im), beta(init_im, 1);
+
+    reset();
+    axpy(Q, n, a, x, 1, y, 2).wait();
+    check(y, 2, [&](std::size_t i) {
+      return alpha * x_input<T>(i) + y_input<T>(i);
+    });
+
+    reset();
+    axpby(Q, n, a, x, 1, b, y, 2).wait();
+    check(y, 2, [&](std::size_t i) {
+      return alpha * x_input<T>(i) + beta * y_input<T>(i);
+    });
+
+    reset();
+    waxpby(Q, n, a, x, 1, b, y, 2, w, 1).wait();
+    check(w, 1, [&](std::size_t i) {
+      return alpha * x_input<T>(i) + beta * y_input<T>(i);
+    });
+
+    // beta == 0 must not read y, so NaNs in y do not reach the result
+    reset();
+    const T nan = std::numeric_limits<T>::quiet_NaN();
+    for (std::size_t i = 0; i < n; ++i)
+      y[2 * i] = complex<T>(nan, nan);
+    waxpby(Q, n, a, x, 1, complex<T>(0, 0), y, 2, w, 1).wait();
+    check(w, 1, [&](std::size_t i) { return alpha * x_input<T>(i); });
+    axpby(Q, n, a, x, 1, complex<T>(0, 0), y, 2).wait();
+    check(y, 2, [&](std::size_t i) { return alpha * x_input<T>(i); });
+
+    reset();
+    auto e = scal(Q, n, a, x, 1);
+    scal(Q, n, T(2), y, 2, {e}).wait();
+    check(x, 1, [&](std::size_t i) { return alpha * x_input<T>(i); });
+    check(y, 2, [&](std::size_t i) { return T(2) * y_input<T>(i); });
+
+    reset();
+    copy(Q, n, x, 1, y, -2).wait();
+    check(y, 2, [&](std::size_t i) { return x_input<T>(n - 1 - i); });
+    copy_conj(Q, n, x, 1, w, 1).wait();
+    check(w, 1, [&](std::size_t i) { return std::conj(x_input<T>(i)); });
+
+    reset();
+    swap(Q, n, x, 1, y, 2).wait();
+    check(x, 1, [&](std::size_t i) { return y_input<T>(i); });
+    check(y, 2, [&](std::size_t i) { return x_input<T>(i); });
+
+    // Complex and real sines
+    reset();
+    rot(Q, n, x, 1, y, 2, T(2), b).wait();
+    check(x, 1, [&](std::size_t i) {
+      return T(2) * x_input<T>(i) + beta * y_input<T>(i);
+    });
+    check(y, 2, [&](std::size_t i) {
+      return T(2) * y_input<T>(i) - std::conj(beta) * x_input<T>(i);
+    });
+    reset();
+    rot(Q, n, x, 1, y, 2, T(1), T(-1)).wait();
+    check(x, 1, [&](std::size_t i) { return x_input<T>(i) - y_input<T>(i); });
+    check(y, 2, [&](std::size_t i) { return y_input<T>(i) + x_input<T>(i); });
+
+    // Untouched padding between the strided elements of y
+    for (std::size_t i = 0; i < n; ++i)
+      pass &= check_results(y[2 * i + 1], std::complex<T>(-7, -7),
+                            /*is_device*/ true);
+
+    sycl::free(x, Q);
+    sycl::free(y, Q);
+    sycl::free(w, Q);
+
+    return pass;
+  }
+};
+
+int main() {
+  sycl::queue Q;
+
+  bool test_passes = true;
+  test_passes &= test_valid_types<test_blas_level1>(Q, 2.0, -1.0);
+
+  if (!test_passes)
+    std::cerr << "level-1 BLAS complex test fails\n";
+
+  return !test_passes;
+}
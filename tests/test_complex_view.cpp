@@ -0,0 +1,84 @@
+#include "test_helper.hpp"
+
+#include "sycl_ext_complex_view.hpp"
+
+using namespace sycl::ext::cplx;
+
+static_assert(std::is_trivially_copyable_v<complex_view<double, 2>>);
+static_assert(std::is_trivially_copyable_v<complex_view<float, 3, true>>);
+static_assert(std::is_same_v<complex_view<float, 2>::reference,
+                             complex<float> &>);
+static_assert(std::is_same_v<complex_view<float, 2, true>::reference,
+                             complex<float>>);
+
+template <typename T> struct test_view_exp {
+  bool operator()(sycl::queue &Q, T init_re, T init_im) {
+    bool pass = true;
+
+    constexpr std::size_t rows = 3;
+    constexpr std::size_t cols = 4;
+
+    auto *in = sycl::malloc_shared<complex<T>>(rows * cols, Q);
+    auto *out = sycl::malloc_shared<complex<T>>(rows * cols, Q);
+
+    std::complex<T> std_in[rows][cols];
+    for (std::size_t i = 0; i < rows; ++i) {
+      for (std::size_t j = 0; j < cols; ++j) {
+        T re = init_re * T(i + 1);
+        T im = init_im - T(j);
+        in[i * cols + j] = complex<T>(re, im);
+        std_in[i][j] = init_std_complex(re, im);
+      }
+    }
+
+    // Read the Hermitian transpose of `in` and apply exp elementwise
+    auto in_view = make_complex_view(in, rows, cols);
+    auto out_view = make_complex_view(out, cols, rows);
+    auto in_h = conj_transpose(in_view);
+
+    if (in_h.extent(0) != cols || in_h.extent(1) != rows ||
+        in_h.is_contiguous() || !in_view.is_contiguous())
+      pass = false;
+
+    Q.parallel_for(out_view.get_range(), [=](sycl::id<2> idx) {
+       out_view[idx] = sycl::ext::cplx::exp(in_h[idx]);
+     }).wait();
+
+    for (std::size_t i = 0; i < cols; ++i) {
+      for (std::size_t j = 0; j < rows; ++j) {
+        std::complex<T> std_out = std::exp(std::conj(std_in[j][i]));
+        pass &= check_results(out_view(i, j), std_out, /*is_device*/ true);
+      }
+    }
+
+    // Every other column of the last row, read back to front
+    auto row = in_view.select(0, rows - 1).slice(0, 0, cols / 2, 2).reverse(0);
+    Q.single_task([=]() {
+       for (std::size_t j = 0; j < row.extent(0); ++j)
+         out[j] = row(j);
+     }).wait();
+
+    for (std::size_t j = 0; j < cols / 2; ++j) {
+      std::complex<T> std_out = std_in[rows - 1][cols - 2 - 2 * j];
+      pass &= check_results(out[j], std_out, /*is_device*/ true);
+    }
+
+    sycl::free(in, Q);
+    sycl::free(out, Q);
+
+    return pass;
+  }
+};
+
+int main() {
+  sycl::queue Q;
+
+  bool test_passes = true;
+  test_passes &= test_valid_types<test_view_exp>(Q, 0.42, 2.02);
+  test_passes &= test_valid_types<test_view_exp>(Q, -1.5, 0.5);
+
+  if (!test_passes)
+    std::cerr << "complex_view test fails\n";
+
+  return !test_passes;
+}
@@ -0,0 +1,62 @@
+#include "test_helper.hpp"
+
+#include "sycl_ext_complex_blas.hpp"
+
+using namespace sycl::ext::cplx;
+
+template <typename T> struct test_dot {
+  bool operator()(sycl::queue &Q, T init_re, T init_im) {
+    bool pass = true;
+    constexpr std::size_t n = 300;
+
+    auto *x = sycl::malloc_shared<complex<T>>(n, Q);
+    auto *y = sycl::malloc_shared<complex<T>>(2 * n, Q);
+    auto *result = sycl::malloc_shared<complex<T>>(4, Q);
+
+    // Small integers keep every partial sum exact
+    for (std::size_t i = 0; i < n; ++i) {
+      x[i] = complex<T>(init_re * T(i % 3), init_im);
+      y[2 * i] = complex<T>(T(i % 2), -init_re);
+      y[2 * i + 1] = complex<T>(0, 0);
+    }
+
+    auto e1 = dotu(Q, n, x, 1, y, 2, &result[0]);
+    auto e2 = dotc(Q, n, x, 1, y, 2, &result[1]);
+    // Reversed y: element i of y is y[2 * (n - 1 - i)]
+    auto e3 = dotc(Q, n, x, 1, y, -2, &result[2]);
+    // Wider accumulator
+    auto e4 = dotu<double>(Q, n, x, 1, y, 2, &result[3]);
+    sycl::event::wait({e1, e2, e3, e4});
+
+    std::complex<T> std_dotu(0, 0), std_dotc(0, 0), std_dotc_rev(0, 0);
+    for (std::size_t i = 0; i < n; ++i) {
+      std::complex<T> std_x = static_cast<std::complex<T>>(x[i]);
+      std_dotu += std_x * static_cast<std::complex<T>>(y[2 * i]);
+      std_dotc += std::conj(std_x) * static_cast<std::complex<T>>(y[2 * i]);
+      std_dotc_rev += std::conj(std_x) *
+                      static_cast<std::complex<T>>(y[2 * (n - 1 - i)]);
+    }
+    pass &= check_results(result[0], std_dotu, /*is_device*/ true);
+    pass &= check_results(result[1], std_dotc, /*is_device*/ true);
+    pass &= check_results(result[2], std_dotc_rev, /*is_device*/ true);
+    pass &= check_results(result[3], std_dotu, /*is_device*/ true);
+
+    sycl::free(x, Q);
+    sycl::free(y, Q);
+    sycl::free(result, Q);
+
+    return pass;
+  }
+};
+
+int main() {
+  sycl::queue Q;
+
+  bool test_passes = true;
+  test_passes &= test_valid_types<test_dot>(Q, 1.0, -2.0);
+
+  if (!test_passes)
+    std::cerr << "dot complex test fails\n";
+
+  return !test_passes;
+}
@@ -0,0 +1,117 @@
+#include "test_helper.hpp"
+
+#include "sycl_ext_complex_fft.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+using namespace sycl::ext::cplx;
+
+template <typename T> std::complex<T> input(std::size_t b, std::size_t j) {
+  return std::complex<T>(T(int((j * 7 + b) % 11) - 5), T(int(j % 4) - 1));
+}
+
+// Direct DFT in long double as the reference
+template <typename T>
+std::complex<T> dft(std::size_t b, std::size_t n, std::size_t k, bool forward) {
+  const long double pi = 3.141592653589793238462643383279502884L;
+  std::complex<long double> acc(0, 0);
+  for (std::size_t j = 0; j < n; ++j) {
+    const long double angle = 2 * pi * (long double)((j * k) % n) / n;
+    const std::complex<long double> w(std::cos(angle),
+                                      forward ? -std::sin(angle)
+                                              : std::sin(angle));
+    const std::complex<T> x = input<T>(b, j);
+    acc += w * std::complex<long double>(x.real(), x.imag());
+  }
+  return std::complex<T>(T(acc.real()), T(acc.imag()));
+}
+
+// The output error grows with the size and magnitude of the sum, so compare
+// against the largest reference value rather than element by element.
+template <typename T>
+bool close(complex<T> out, std::complex<T> ref, T scale, std::size_t n) {
+  const T tol = T(8) * std::log2(T(n) + 1) *
+                std::numeric_limits<T>::epsilon() * scale;
+  if (std::abs(out.real() - ref.real()) <= tol &&
+      std::abs(out.imag() - ref.imag()) <= tol)
+    return true;
+  std::cerr << "Test failed with complex_type: " << get_typename<T>()
+            << " n " << n << " Output: " << out << " Reference: " << ref
+            << std::endl;
+  return false;
+}
+
+template <typename T> struct test_fft {
+  bool operator()(sycl::queue &Q) {
+    if constexpr (std::is_same_v<T, sycl::half>) {
+      return true;
+    } else {
+      bool pass = true;
+      constexpr std::size_t batch = 3;
+      // Single radices, mixed radices and odd stage counts
+      const std::size_t sizes[] = {1,  2,  3,   4,   5,   7,   8,  16,
+                                   30, 64, 105, 128, 210, 512, 2520};
+
+      for (std::size_t n : sizes) {
+        auto *in = sycl::malloc_shared<complex<T>>(batch * n, Q);
+        auto *out = sycl::malloc_shared<complex<T>>(batch * n, Q);
+        for (bool forward : {true, false}) {
+          const auto dir =
+              forward ? fft_direction::forward : fft_direction::backward;
+          std::vector<std::complex<T>> ref(batch * n);
+          T scale = 0;
+          for (std::size_t b = 0; b < batch; ++b)
+            for (std::size_t k = 0; k < n; ++k) {
+              ref[b * n + k] = dft<T>(b, n, k, forward);
+              scale = std::max(scale, std::abs(ref[b * n + k]));
+            }
+
+          // Out of place
+          for (std::size_t b = 0; b < batch; ++b)
+            for (std::size_t j = 0; j < n; ++j)
+              in[b * n + j] = input<T>(b, j);
+          fft(Q, dir, n, batch, in, out).wait();
+          for (std::size_t e = 0; e < batch * n; ++e)
+            pass &= close(out[e], ref[e], scale, n);
+
+          // In place, scaled by 1 / n
+          fft(Q, dir, n, batch, in, in, T(1) / T(n)).wait();
+          for (std::size_t e = 0; e < batch * n; ++e) {
+            std::complex<T> std_out = ref[e] / T(n);
+            pass &= close(in[e], std_out, scale / T(n), n);
+          }
+        }
+        sycl::free(in, Q);
+        sycl::free(out, Q);
+      }
+
+      // Lengths with other prime factors are rejected
+      bool thrown = false;
+      try {
+        fft<T>(Q, fft_direction::forward, 22, 1, nullptr, nullptr);
+      } catch (const std::invalid_argument &) {
+        thrown = true;
+      }
+      pass &= thrown;
+
+      return pass;
+    }
+  }
+};
+
+int main() {
+  sycl::queue Q;
+
+  bool test_passes = true;
+  test_passes &= test_valid_types<test_fft>(Q);
+
+  if (!test_passes)
+    std::cerr << "fft complex test fails\n";
+
+  return !test_passes;
+}
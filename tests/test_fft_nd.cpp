@@ -0,0 +1,128 @@
+#include "test_helper.hpp"
+
+#include "sycl_ext_complex_fft.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+using namespace sycl::ext::cplx;
+
+typedef std::complex<long double> ref_t;
+
+template <typename T> std::complex<T> input(std::size_t j) {
+  return std::complex<T>(T(int((j * 7) % 11) - 5), T(int((j * 3) % 5) - 2));
+}
+
+// Direct DFT along one axis of a row-major array in long double
+void dft_axis(std::vector<ref_t> &a, std::size_t n, std::size_t stride,
+              bool forward) {
+  const long double pi = 3.141592653589793238462643383279502884L;
+  std::vector<ref_t> r(a.size());
+  for (std::size_t e = 0; e < a.size(); ++e) {
+    const std::size_t k = e / stride % n, base = e - k * stride;
+    ref_t acc(0, 0);
+    for (std::size_t j = 0; j < n; ++j) {
+      const long double angle = 2 * pi * (long double)((j * k) % n) / n;
+      acc += ref_t(std::cos(angle), forward ? -std::sin(angle)
+                                            : std::sin(angle)) *
+             a[base + j * stride];
+    }
+    r[e] = acc;
+  }
+  a = r;
+}
+
+template <typename T>
+bool check_nd(sycl::queue &Q, const std::vector<std::size_t> &dims) {
+  bool pass = true;
+  std::size_t total = 1;
+  for (std::size_t d : dims)
+    total *= d;
+  auto *in = sycl::malloc_shared<complex<T>>(total, Q);
+  auto *out = sycl::malloc_shared<complex<T>>(total, Q);
+
+  for (bool forward : {true, false}) {
+    const auto dir = forward ? fft_direction::forward : fft_direction::backward;
+    std::vector<ref_t> ref(total);
+    for (std::size_t j = 0; j < total; ++j)
+      ref[j] = ref_t(input<T>(j).real(), input<T>(j).imag());
+    std::size_t stride = total;
+    for (std::size_t d : dims) {
+      stride /= d;
+      dft_axis(ref, d, stride, forward);
+    }
+    long double scale = 0;
+    for (const ref_t &r : ref)
+      scale = std::max(scale, std::abs(r));
+    const T tol = T(8) * std::log2(T(total) + 1) *
+                  std::numeric_limits<T>::epsilon() * T(scale);
+
+    auto run = [&](const complex<T> *src, complex<T> *dst, T s) {
+      if (dims.size() == 2)
+        fft_2d(Q, dir, dims[0], dims[1], src, dst, s).wait();
+      else
+        fft_3d(Q, dir, dims[0], dims[1], dims[2], src, dst, s).wait();
+    };
+    auto compare = [&](const complex<T> *res, T s) {
+      for (std::size_t e = 0; e < total; ++e) {
+        const complex<T> r(T(ref[e].real() * s), T(ref[e].imag() * s));
+        if (std::abs(res[e].real() - r.real()) > tol * s ||
+            std::abs(res[e].imag() - r.imag()) > tol * s) {
+          std::cerr << "Test failed with complex_type: " << get_typename<T>()
+                    << " dims " << dims.size() << " element " << e
+                    << " Output: " << res[e] << " Reference: " << r
+                    << std::endl;
+          pass = false;
+        }
+      }
+    };
+
+    // Out of place
+    for (std::size_t j = 0; j < total; ++j)
+      in[j] = input<T>(j);
+    run(in, out, T(1));
+    compare(out, T(1));
+
+    // In place, scaled by 1 / total
+    run(in, in, T(1) / T(total));
+    compare(in, T(1) / T(total));
+  }
+
+  sycl::free(in, Q);
+  sycl::free(out, Q);
+  return pass;
+}
+
+template <typename T> struct test_fft_nd {
+  bool operator()(sycl::queue &Q) {
+    if constexpr (std::is_same_v<T, sycl::half>) {
+      return true;
+    } else {
+      bool pass = true;
+      pass &= check_nd<T>(Q, {6, 10});
+      pass &= check_nd<T>(Q, {16, 1});
+      pass &= check_nd<T>(Q, {1, 12});
+      pass &= check_nd<T>(Q, {12, 35});
+      pass &= check_nd<T>(Q, {4, 6, 5});
+      pass &= check_nd<T>(Q, {8, 3, 7});
+      pass &= check_nd<T>(Q, {2, 1, 16});
+      pass &= check_nd<T>(Q, {16, 16, 16});
+      return pass;
+    }
+  }
+};
+
+int main() {
+  sycl::queue Q;
+
+  bool test_passes = true;
+  test_passes &= test_valid_types<test_fft_nd>(Q);
+
+  if (!test_passes)
+    std::cerr << "fft_2d/fft_3d complex test fails\n";
+
+  return !test_passes;
+}
@@ -0,0 +1,111 @@
+#include "test_helper.hpp"
+
+#include "sycl_ext_complex_fft.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+using namespace sycl::ext::cplx;
+
+template <typename T> T input(std::size_t b, std::size_t j) {
+  return T(int((j * 5 + b * 3) % 13) - 6);
+}
+
+// Direct forward DFT of the real input in long double
+template <typename T>
+std::complex<T> dft(std::size_t b, std::size_t n, std::size_t k) {
+  const long double pi = 3.141592653589793238462643383279502884L;
+  std::complex<long double> acc(0, 0);
+  for (std::size_t j = 0; j < n; ++j) {
+    const long double angle = 2 * pi * (long double)((j * k) % n) / n;
+    acc += std::complex<long double>(std::cos(angle), -std::sin(angle)) *
+           (long double)input<T>(b, j);
+  }
+  return std::complex<T>(T(acc.real()), T(acc.imag()));
+}
+
+template <typename T> bool close(T out, T ref, T scale, std::size_t n) {
+  const T tol = T(8) * std::log2(T(n) + 1) *
+                std::numeric_limits<T>::epsilon() * scale;
+  if (std::abs(out - ref) <= tol)
+    return true;
+  std::cerr << "Test failed with complex_type: " << get_typename<T>()
+            << " n " << n << " Output: " << out << " Reference: " << ref
+            << std::endl;
+  return false;
+}
+
+template <typename T> struct test_fft_real {
+  bool operator()(sycl::queue &Q) {
+    if constexpr (std::is_same_v<T, sycl::half>) {
+      return true;
+    } else {
+      bool pass = true;
+      constexpr std::size_t batch = 3;
+      // Odd and even half lengths, including a single complex point
+      const std::size_t sizes[] = {2, 4, 6, 10, 14, 16, 30, 64, 210, 256};
+
+      for (std::size_t n : sizes) {
+        const std::size_t h = n / 2 + 1;
+        auto *x = sycl::malloc_shared<T>(batch * n, Q);
+        auto *spec = sycl::malloc_shared<complex<T>>(batch * h, Q);
+        auto *back = sycl::malloc_shared<T>(batch * n, Q);
+        for (std::size_t b = 0; b < batch; ++b)
+          for (std::size_t j = 0; j < n; ++j)
+            x[b * n + j] = input<T>(b, j);
+
+        std::vector<std::complex<T>> ref(batch * h);
+        T scale = 0;
+        for (std::size_t b = 0; b < batch; ++b)
+          for (std::size_t k = 0; k < h; ++k) {
+            ref[b * h + k] = dft<T>(b, n, k);
+            scale = std::max(scale, std::abs(ref[b * h + k]));
+          }
+
+        fft_r2c(Q, n, batch, x, spec).wait();
+        for (std::size_t e = 0; e < batch * h; ++e) {
+          pass &= close(spec[e].real(), ref[e].real(), scale, n);
+          pass &= close(spec[e].imag(), ref[e].imag(), scale, n);
+        }
+
+        // Scaled round trip
+        fft_c2r(Q, n, batch, spec, back, T(1) / T(n)).wait();
+        for (std::size_t e = 0; e < batch * n; ++e)
+          pass &= close(back[e], x[e], scale / T(n), n);
+
+        sycl::free(x, Q);
+        sycl::free(spec, Q);
+        sycl::free(back, Q);
+      }
+
+      // Odd lengths and half lengths with other prime factors are rejected
+      for (std::size_t n : {7, 22}) {
+        bool thrown = false;
+        try {
+          fft_r2c<T>(Q, n, 1, nullptr, nullptr);
+        } catch (const std::invalid_argument &) {
+          thrown = true;
+        }
+        pass &= thrown;
+      }
+
+      return pass;
+    }
+  }
+};
+
+int main() {
+  sycl::queue Q;
+
+  bool test_passes = true;
+  test_passes &= test_valid_types<test_fft_real>(Q);
+
+  if (!test_passes)
+    std::cerr << "fft_r2c/fft_c2r complex test fails\n";
+
+  return !test_passes;
+}
@@ -0,0 +1,131 @@
+#include "test_helper.hpp"
+
+#include "sycl_ext_complex_fixed.hpp"
+
+using namespace sycl::ext::cplx;
+
+// Check IQ sample layout and that fixed-point types stay out of gencomplex
+static_assert(sizeof(cq15) == 2 * sizeof(std::int16_t));
+static_assert(sizeof(cq7) == 2 * sizeof(std::int8_t));
+static_assert(std::is_trivially_copyable_v<cq15>);
+static_assert(is_fixed_complex<cq15>::value);
+static_assert(!is_fixed_complex<complex<float>>::value);
+static_assert(!is_gencomplex<cq15>::value);
+
+template <typename T, int F> bool test_saturating_arithmetic() {
+  bool pass = true;
+  typedef fixed_complex<T, F> fc;
+  constexpr T hi = std::numeric_limits<T>::max();
+  constexpr T lo = std::numeric_limits<T>::min();
+
+  pass &= (fc(hi, lo) + fc(1, -1)) == fc(hi, lo);
+  pass &= (fc(lo, hi) - fc(1, -1)) == fc(lo, hi);
+  pass &= -fc(lo, 0) == fc(hi, 0);
+  pass &= conj(fc(0, lo)) == fc(0, hi);
+
+  // (-1 - 1i) * (-1 - 1i) = 2i, which saturates to just below 1i
+  pass &= (fc(lo, lo) * fc(lo, lo)) == fc(0, hi);
+
+  pass &= scale(fc(hi, lo), 1) == fc(hi, lo);
+  pass &= scale(fc(4, -4), -1) == fc(2, -2);
+  // Shifts at and beyond the accumulator width saturate or flush to zero
+  pass &= scale(fc(1, -1), 40) == fc(hi, lo);
+  pass &= scale(fc(hi, lo), -40) == fc(0, 0);
+  pass &= scale(fc(1, -1), 1000) == fc(hi, lo);
+  pass &= scale(fc(hi, lo), -1000) == fc(0, 0);
+  pass &= scale(fc(0, 0), std::numeric_limits<int>::max()) == fc(0, 0);
+  pass &= scale(fc(hi, lo), std::numeric_limits<int>::min()) == fc(0, 0);
+
+  if (!pass)
+    std::cerr << "Saturating arithmetic fails for " << sizeof(T) * 8
+              << "-bit fixed_complex\n";
+  return pass;
+}
+
+template <typename T, int F>
+bool test_multiply(sycl::queue &Q, float re1, float im1, float re2,
+                   float im2) {
+  bool pass = true;
+  typedef fixed_complex<T, F> fc;
+
+  fc a(complex<float>(re1, im1));
+  fc b(complex<float>(re2, im2));
+  auto *out = sycl::malloc_shared<fc>(1, Q);
+
+  Q.single_task([=]() { out[0] = a * b; }).wait();
+
+  // Products round to nearest, so stay within one unit in the last place
+  std::complex<float> ref = static_cast<std::complex<float>>(
+                                static_cast<complex<float>>(a)) *
+                            static_cast<std::complex<float>>(
+                                static_cast<complex<float>>(b));
+  complex<float> got = static_cast<complex<float>>(out[0]);
+  float ulp = std::ldexp(1.0f, -F);
+  if (std::abs(got.real() - ref.real()) > ulp ||
+      std::abs(got.imag() - ref.imag()) > ulp) {
+    std::cerr << "fixed_complex multiply fails: " << got << " vs " << ref
+              << std::endl;
+    pass = false;
+  }
+
+  sycl::free(out, Q);
+  return pass;
+}
+
+template <typename T> struct test_widen {
+  bool operator()(sycl::queue &Q, T, T) {
+    bool pass = true;
+    constexpr std::size_t n = 64;
+
+    auto *iq = sycl::malloc_shared<std::int16_t>(2 * n, Q);
+    auto *out = sycl::malloc_shared<complex<T>>(n, Q);
+    auto *back = sycl::malloc_shared<cq15>(n, Q);
+
+    for (std::size_t i = 0; i < 2 * n; ++i)
+      iq[i] = static_cast<std::int16_t>((i * 977) % 65536 - 32768);
+
+    // Raw interleaved samples are consumed in place
+    const cq15 *samples = reinterpret_cast<const cq15 *>(iq);
+    auto e = widen(Q, samples, out, n, T(2));
+    narrow(Q, out, back, n, {e}).wait();
+
+    for (std::size_t i = 0; i < n; ++i) {
+      std::complex<T> ref(T(std::ldexp(float(iq[2 * i]), -14)),
+                          T(std::ldexp(float(iq[2 * i + 1]), -14)));
+      pass &= check_results(out[i], ref, /*is_device*/ true);
+    }
+
+    // Narrowing a doubled signal saturates at full scale
+    for (std::size_t i = 0; i < n && std::is_same_v<T, double>; ++i) {
+      std::int16_t re = iq[2 * i] < -16384 ? -32768
+                        : iq[2 * i] > 16383 ? 32767
+                                            : std::int16_t(2 * iq[2 * i]);
+      pass &= back[i].real() == re;
+    }
+
+    sycl::free(iq, Q);
+    sycl::free(out, Q);
+    sycl::free(back, Q);
+
+    return pass;
+  }
+};
+
+int main() {
+  sycl::queue Q;
+
+  bool test_passes = true;
+  test_passes &= test_saturating_arithmetic<std::int16_t, 15>();
+  test_passes &= test_saturating_arithmetic<std::int8_t, 7>();
+
+  test_passes &= test_multiply<std::int16_t, 15>(Q, 0.5f, -0.25f, 0.3f, 0.7f);
+  test_passes &= test_multiply<std::int16_t, 12>(Q, 3.1f, -2.2f, 1.5f, 0.9f);
+  test_passes &= test_multiply<std::int8_t, 7>(Q, 0.5f, -0.25f, 0.3f, 0.7f);
+
+  test_passes &= test_valid_types<test_widen>(Q, 0, 0);
+
+  if (!test_passes)
+    std::cerr << "fixed_complex test fails\n";
+
+  return !test_passes;
+}
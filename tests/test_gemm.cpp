@@ -0,0 +1,117 @@
+#include "test_helper.hpp"
+
+#include "sycl_ext_complex_gemm.hpp"
+
+#include <limits>
+#include <vector>
+
+using namespace sycl::ext::cplx;
+
+// Small integers keep every result exact, for 3M as well
+template <typename T> std::complex<T> a_input(std::size_t i, std::size_t j) {
+  return std::complex<T>(T((i + 2 * j) % 3), T(int(i % 2) - int(j % 3)));
+}
+template <typename T> std::complex<T> b_input(std::size_t i, std::size_t j) {
+  return std::complex<T>(T(int(j % 3) - 1), T((i + j) % 2));
+}
+// Element (i, j) of op(M) for M(i, j) = input(i, j)
+template <typename T, typename F>
+std::complex<T> op(F input, transpose trans, std::size_t i, std::size_t j) {
+  if (trans == transpose::nontrans)
+    return input(i, j);
+  if (trans == transpose::trans)
+    return input(j, i);
+  return std::conj(input(j, i));
+}
+
+template <typename T, bool ThreeM> struct test_gemm_impl {
+  bool operator()(sycl::queue &Q, T init_re, T init_im) {
+    bool pass = true;
+    constexpr std::size_t m = 45, n = 38, k = 50, ld = 53;
+
+    auto *a = sycl::malloc_shared<complex<T>>(ld * ld, Q);
+    auto *b = sycl::malloc_shared<complex<T>>(ld * ld, Q);
+    auto *c = sycl::malloc_shared<complex<T>>(ld * ld, Q);
+
+    const complex<T> alpha(init_re, init_im), beta(1, -1);
+    const std::complex<T> std_alpha(init_re, init_im), std_beta(1, -1);
+    auto a_fn = [](std::size_t i, std::size_t j) { return a_input<T>(i, j); };
+    auto b_fn = [](std::size_t i, std::size_t j) { return b_input<T>(i, j); };
+
+    for (auto l : {layout::row_major, layout::col_major}) {
+      auto at = [&](std::size_t i, std::size_t j) {
+        return l == layout::row_major ? i * ld + j : i + j * ld;
+      };
+      for (std::size_t i = 0; i < ld; ++i)
+        for (std::size_t j = 0; j < ld; ++j) {
+          a[at(i, j)] = a_input<T>(i, j);
+          b[at(i, j)] = b_input<T>(i, j);
+        }
+
+      for (auto ta :
+           {transpose::nontrans, transpose::trans, transpose::conjtrans}) {
+        for (auto tb :
+             {transpose::nontrans, transpose::trans, transpose::conjtrans}) {
+          auto run = [&](complex<T> beta) {
+            if constexpr (ThreeM)
+              return gemm3m(Q, l, ta, tb, m, n, k, alpha, a, ld, b, ld, beta,
+                            c, ld);
+            else
+              return gemm(Q, l, ta, tb, m, n, k, alpha, a, ld, b, ld, beta, c,
+                          ld);
+          };
+
+          // beta == 0 must not read C
+          for (std::size_t i = 0; i < ld * ld; ++i)
+            c[i] = complex<T>(std::numeric_limits<T>::quiet_NaN(), 0);
+          run(complex<T>(0, 0)).wait();
+
+          std::vector<std::complex<T>> std_c(m * n);
+          for (std::size_t i = 0; i < m; ++i)
+            for (std::size_t j = 0; j < n; ++j) {
+              std::complex<T> acc(0, 0);
+              for (std::size_t p = 0; p < k; ++p)
+                acc += op<T>(a_fn, ta, i, p) * op<T>(b_fn, tb, p, j);
+              std_c[i * n + j] = std_alpha * acc;
+              pass &= check_results(c[at(i, j)], std_c[i * n + j],
+                                    /*is_device*/ true);
+            }
+
+          // Accumulate into C
+          run(beta).wait();
+          for (std::size_t i = 0; i < m; ++i)
+            for (std::size_t j = 0; j < n; ++j) {
+              std::complex<T> acc(0, 0);
+              for (std::size_t p = 0; p < k; ++p)
+                acc += op<T>(a_fn, ta, i, p) * op<T>(b_fn, tb, p, j);
+              std::complex<T> std_out{};
+              std_out = std_alpha * acc + std_beta * std_c[i * n + j];
+              pass &= check_results(c[at(i, j)], std_out, /*is_device*/ true);
+            }
+        }
+      }
+    }
+
+    sycl::free(a, Q);
+    sycl::free(b, Q);
+    sycl::free(c, Q);
+
+    return pass;
+  }
+};
+
+template <typename T> using test_gemm = test_gemm_impl<T, false>;
+template <typename T> using test_gemm3m = test_gemm_impl<T, true>;
+
+int main() {
+  sycl::queue Q;
+
+  bool test_passes = true;
+  test_passes &= test_valid_types<test_gemm>(Q, 1.0, -1.0);
+  test_passes &= test_valid_types<test_gemm3m>(Q, 1.0, -1.0);
+
+  if (!test_passes)
+    std::cerr << "gemm complex test fails\n";
+
+  return !test_passes;
+}
@@ -0,0 +1,141 @@
+#include "test_helper.hpp"
+
+#include "sycl_ext_complex_gemm.hpp"
+
+#include <algorithm>
+#include <vector>
+
+using namespace sycl::ext::cplx;
+
+// Small integers keep every result exact
+template <typename T>
+std::complex<T> input(std::size_t m, std::size_t i, std::size_t j) {
+  return std::complex<T>(T((m + i + 2 * j) % 3), T(int(i % 2) - int(j % 3)));
+}
+// Element (i, j) of op(M) for M(i, j) = input(m, i, j)
+template <typename T>
+std::complex<T> op_m(std::size_t m, transpose trans, std::size_t i,
+                     std::size_t j) {
+  if (trans == transpose::nontrans)
+    return input<T>(m, i, j);
+  if (trans == transpose::trans)
+    return input<T>(m, j, i);
+  return std::conj(input<T>(m, j, i));
+}
+
+template <typename T, std::size_t M, std::size_t N, std::size_t K>
+bool test_size(sycl::queue &Q, T init_re, T init_im) {
+  bool pass = true;
+  constexpr std::size_t batch = 37;
+  constexpr std::size_t ld = std::max({M, N, K, std::size_t(32)}) + 1;
+  constexpr std::size_t stride = ld * ld + 3;
+
+  auto *a = sycl::malloc_shared<complex<T>>(batch * stride, Q);
+  auto *b = sycl::malloc_shared<complex<T>>(batch * stride, Q);
+  auto *c = sycl::malloc_shared<complex<T>>(batch * stride, Q);
+  auto *a_ptrs = sycl::malloc_shared<const complex<T> *>(batch, Q);
+  auto *b_ptrs = sycl::malloc_shared<const complex<T> *>(batch, Q);
+  auto *c_ptrs = sycl::malloc_shared<complex<T> *>(batch, Q);
+  // The pointer arrays visit the matrices in reverse
+  for (std::size_t m = 0; m < batch; ++m) {
+    a_ptrs[m] = a + (batch - 1 - m) * stride;
+    b_ptrs[m] = b + (batch - 1 - m) * stride;
+    c_ptrs[m] = c + (batch - 1 - m) * stride;
+  }
+
+  const complex<T> alpha(init_re, init_im), beta(1, -1);
+  const std::complex<T> std_alpha(init_re, init_im), std_beta(1, -1);
+
+  const transpose cases[][2] = {{transpose::nontrans, transpose::nontrans},
+                                {transpose::trans, transpose::conjtrans},
+                                {transpose::conjtrans, transpose::nontrans}};
+  for (auto l : {layout::row_major, layout::col_major}) {
+    auto at = [&](std::size_t m, std::size_t i, std::size_t j) {
+      return m * stride + (l == layout::row_major ? i * ld + j : i + j * ld);
+    };
+    for (std::size_t m = 0; m < batch; ++m)
+      for (std::size_t i = 0; i < ld; ++i)
+        for (std::size_t j = 0; j < ld; ++j) {
+          a[at(m, i, j)] = input<T>(m, i, j);
+          b[at(m, i, j)] = input<T>(m + 1, i, j);
+          c[at(m, i, j)] = complex<T>(T(i % 2), T(j % 3));
+        }
+
+    for (auto &t : cases) {
+      std::vector<std::complex<T>> std_c(batch * M * N);
+      for (std::size_t m = 0; m < batch; ++m)
+        for (std::size_t i = 0; i < M; ++i)
+          for (std::size_t j = 0; j < N; ++j) {
+            std::complex<T> acc(0, 0);
+            for (std::size_t p = 0; p < K; ++p)
+              acc += op_m<T>(m, t[0], i, p) * op_m<T>(m + 1, t[1], p, j);
+            std::complex<T> std_out{};
+            std_out = std::complex<T>(T(i % 2), T(j % 3));
+            std_c[(m * M + i) * N + j] = std_alpha * acc + std_beta * std_out;
+          }
+
+      // Strided, from the initial C
+      gemm_batch<M, N, K>(Q, l, t[0], t[1], alpha, a, ld, stride, b, ld,
+                          stride, beta, c, ld, stride, batch)
+          .wait();
+      for (std::size_t m = 0; m < batch; ++m)
+        for (std::size_t i = 0; i < M; ++i)
+          for (std::size_t j = 0; j < N; ++j)
+            pass &= check_results(c[at(m, i, j)], std_c[(m * M + i) * N + j],
+                                  /*is_device*/ true);
+
+      // Pointer arrays, overwriting with beta == 0
+      gemm_batch<M, N, K>(Q, l, t[0], t[1], alpha, a_ptrs, ld, b_ptrs, ld,
+                          complex<T>(0, 0), c_ptrs, ld, batch)
+          .wait();
+      for (std::size_t m = 0; m < batch; ++m)
+        for (std::size_t i = 0; i < M; ++i)
+          for (std::size_t j = 0; j < N; ++j) {
+            std::complex<T> acc(0, 0);
+            for (std::size_t p = 0; p < K; ++p)
+              acc += op_m<T>(m, t[0], i, p) * op_m<T>(m + 1, t[1], p, j);
+            std::complex<T> std_out{};
+            std_out = std_alpha * acc;
+            pass &= check_results(c[at(m, i, j)], std_out, /*is_device*/ true);
+            c[at(m, i, j)] = complex<T>(T(i % 2), T(j % 3));
+          }
+    }
+  }
+
+  sycl::free(a, Q);
+  sycl::free(b, Q);
+  sycl::free(c, Q);
+  sycl::free(a_ptrs, Q);
+  sycl::free(b_ptrs, Q);
+  sycl::free(c_ptrs, Q);
+
+  return pass;
+}
+
+template <typename T> struct test_gemm_batch {
+  bool operator()(sycl::queue &Q, T init_re, T init_im) {
+    bool pass = true;
+    // Register path
+    pass &= test_size<T, 2, 2, 2>(Q, init_re, init_im);
+    pass &= test_size<T, 3, 4, 5>(Q, init_re, init_im);
+    // Local memory path
+    pass &= test_size<T, 5, 7, 3>(Q, init_re, init_im);
+    pass &= test_size<T, 8, 8, 8>(Q, init_re, init_im);
+    pass &= test_size<T, 32, 32, 32>(Q, init_re, init_im);
+    // op(A) beyond 64 KiB of local memory falls back to the register path
+    pass &= test_size<T, 91, 2, 91>(Q, init_re, init_im);
+    return pass;
+  }
+};
+
+int main() {
+  sycl::queue Q;
+
+  bool test_passes = true;
+  test_passes &= test_valid_types<test_gemm_batch>(Q, 1.0, -1.0);
+
+  if (!test_passes)
+    std::cerr << "gemm_batch complex test fails\n";
+
+  return !test_passes;
+}
@@ -0,0 +1,98 @@
+#include "test_helper.hpp"
+
+#include "sycl_ext_complex_blas.hpp"
+
+#include <limits>
+#include <vector>
+
+using namespace sycl::ext::cplx;
+
+// Small integers keep every result exact
+template <typename T> std::complex<T> a_input(std::size_t i, std::size_t j) {
+  return std::complex<T>(T((i + 2 * j) % 3), T(int(i % 2) - int(j % 3)));
+}
+// op(A)(i, j)
+template <typename T>
+std::complex<T> op_a(transpose trans, std::size_t i, std::size_t j) {
+  if (trans == transpose::nontrans)
+    return a_input<T>(i, j);
+  if (trans == transpose::trans)
+    return a_input<T>(j, i);
+  return std::conj(a_input<T>(j, i));
+}
+template <typename T> std::complex<T> x_input(std::size_t j) {
+  return std::complex<T>(T(j % 2), T(1) - T(j % 3));
+}
+
+template <typename T> struct test_gemv {
+  bool operator()(sycl::queue &Q, T init_re, T init_im) {
+    bool pass = true;
+    constexpr std::size_t m = 37, n = 70, lda = 75;
+
+    auto *a = sycl::malloc_shared<complex<T>>(lda * lda, Q);
+    auto *x = sycl::malloc_shared<complex<T>>(2 * lda, Q);
+    auto *y = sycl::malloc_shared<complex<T>>(lda, Q);
+    for (std::size_t j = 0; j < 2 * lda; ++j)
+      x[j] = x_input<T>(j);
+
+    const complex<T> alpha(init_re, init_im), beta(1, -1);
+    const std::complex<T> std_alpha(init_re, init_im), std_beta(1, -1);
+
+    for (auto l : {layout::row_major, layout::col_major}) {
+      for (std::size_t i = 0; i < m; ++i)
+        for (std::size_t j = 0; j < n; ++j)
+          a[l == layout::row_major ? i * lda + j : i + j * lda] =
+              a_input<T>(i, j);
+
+      for (auto trans :
+           {transpose::nontrans, transpose::trans, transpose::conjtrans}) {
+        const bool nontrans = trans == transpose::nontrans;
+        const std::size_t rows = nontrans ? m : n, cols = nontrans ? n : m;
+
+        // x with stride 2, beta == 0 must not read y
+        for (std::size_t i = 0; i < rows; ++i)
+          y[i] = complex<T>(std::numeric_limits<T>::quiet_NaN(), 0);
+        gemv(Q, l, trans, m, n, alpha, a, lda, x, 2, complex<T>(0, 0), y, 1)
+            .wait();
+
+        std::vector<std::complex<T>> std_y(rows);
+        for (std::size_t i = 0; i < rows; ++i) {
+          std::complex<T> acc(0, 0);
+          for (std::size_t j = 0; j < cols; ++j)
+            acc += op_a<T>(trans, i, j) * x_input<T>(2 * j);
+          std_y[i] = std_alpha * acc;
+          pass &= check_results(y[i], std_y[i], /*is_device*/ true);
+        }
+
+        // Accumulate into y, walked backwards
+        gemv(Q, l, trans, m, n, alpha, a, lda, x, 1, beta, y, -1).wait();
+        for (std::size_t i = 0; i < rows; ++i) {
+          std::complex<T> acc(0, 0);
+          for (std::size_t j = 0; j < cols; ++j)
+            acc += op_a<T>(trans, i, j) * x_input<T>(j);
+          std::complex<T> std_out{};
+          std_out = std_alpha * acc + std_beta * std_y[rows - 1 - i];
+          pass &= check_results(y[rows - 1 - i], std_out, /*is_device*/ true);
+        }
+      }
+    }
+
+    sycl::free(a, Q);
+    sycl::free(x, Q);
+    sycl::free(y, Q);
+
+    return pass;
+  }
+};
+
+int main() {
+  sycl::queue Q;
+
+  bool test_passes = true;
+  test_passes &= test_valid_types<test_gemv>(Q, 1.0, -1.0);
+
+  if (!test_passes)
+    std::cerr << "gemv complex test fails\n";
+
+  return !test_passes;
+}
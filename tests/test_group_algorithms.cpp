@@ -0,0 +1,185 @@
+#include "test_helper.hpp"
+
+#include "sycl_ext_complex_group.hpp"
+
+using namespace sycl::ext::cplx;
+
+// Inputs are small nonzero Gaussian integers so sums and products are exact
+// in every type and the tree order of the group algorithms does not matter.
+// None is zero, so a lane combined in the wrong place changes every product.
+template <typename T> complex<T> group_input(std::size_t i) {
+  switch (i % 4) {
+  case 0:
+    return complex<T>(0, 1);
+  case 1:
+    return complex<T>(1, 1);
+  case 2:
+    return complex<T>(1, -1);
+  default:
+    return complex<T>(i % 3 == 0 ? T(-1) : T(2), 0);
+  }
+}
+
+// The sub-group size is chosen by the compiler, so each work-item records its
+// sub-group lane and size and the expected values are computed per sub-group.
+// Sub-groups of a one-dimensional work-group cover consecutive work-items.
+template <typename T> struct test_group_exchange {
+  bool operator()(sycl::queue &Q, T, T) {
+    bool pass = true;
+    constexpr std::size_t n = 8;
+
+    // broadcast, select, shift left, shift right, xor
+    auto *out = sycl::malloc_shared<complex<T>>(5 * n, Q);
+    auto *lanes = sycl::malloc_shared<std::size_t>(2 * n, Q);
+
+    Q.parallel_for(sycl::nd_range<1>(n, n), [=](sycl::nd_item<1> it) {
+       auto sg = it.get_sub_group();
+       const std::size_t i = it.get_global_id(0);
+       const std::size_t lane = sg.get_local_linear_id();
+       const std::size_t size = sg.get_local_linear_range();
+       lanes[i] = lane;
+       lanes[n + i] = size;
+       const complex<T> z = group_input<T>(i);
+       out[i] = group_broadcast(it.get_group(), z, 3);
+       out[n + i] = select_from_group(sg, z, sycl::id<1>((lane + 2) % size));
+       out[2 * n + i] = shift_group_left(sg, z, 1);
+       out[3 * n + i] = shift_group_right(sg, z, 2);
+       out[4 * n + i] = permute_group_by_xor(sg, z, 1);
+     }).wait();
+
+    for (std::size_t i = 0; i < n; ++i) {
+      const std::size_t lane = lanes[i], size = lanes[n + i];
+      const std::size_t base = i - lane;
+      std::complex<T> std_out{};
+      std_out = group_input<T>(3);
+      pass &= check_results(out[i], std_out, /*is_device*/ true);
+      std_out = group_input<T>(base + (lane + 2) % size);
+      pass &= check_results(out[n + i], std_out, /*is_device*/ true);
+      if (lane + 1 < size) {
+        std_out = group_input<T>(i + 1);
+        pass &= check_results(out[2 * n + i], std_out, /*is_device*/ true);
+      }
+      if (lane >= 2) {
+        std_out = group_input<T>(i - 2);
+        pass &= check_results(out[3 * n + i], std_out, /*is_device*/ true);
+      }
+      if ((lane ^ 1) < size) {
+        std_out = group_input<T>(base + (lane ^ 1));
+        pass &= check_results(out[4 * n + i], std_out, /*is_device*/ true);
+      }
+    }
+
+    sycl::free(out, Q);
+    sycl::free(lanes, Q);
+
+    return pass;
+  }
+};
+
+template <typename T> struct test_group_reduce {
+  bool operator()(sycl::queue &Q, T, T) {
+    bool pass = true;
+    constexpr std::size_t n = 8;
+
+    // work-group sum, sub-group sum, sub-group product, product with init
+    auto *out = sycl::malloc_shared<complex<T>>(4 * n, Q);
+    auto *lanes = sycl::malloc_shared<std::size_t>(2 * n, Q);
+
+    Q.parallel_for(sycl::nd_range<1>(n, n), [=](sycl::nd_item<1> it) {
+       auto sg = it.get_sub_group();
+       const std::size_t i = it.get_global_id(0);
+       lanes[i] = sg.get_local_linear_id();
+       lanes[n + i] = sg.get_local_linear_range();
+       const complex<T> z = group_input<T>(i);
+       out[i] = reduce_over_group(it.get_group(), z, sycl::plus<>());
+       out[n + i] = reduce_over_group(sg, z, plus<complex<T>>());
+       out[2 * n + i] = reduce_over_group(sg, z, multiplies<>());
+       out[3 * n + i] = reduce_over_group(sg, z, complex<T>(0, 1),
+                                          sycl::multiplies<complex<T>>());
+     }).wait();
+
+    std::complex<T> std_sum(0, 0);
+    for (std::size_t i = 0; i < n; ++i)
+      std_sum += static_cast<std::complex<T>>(group_input<T>(i));
+
+    for (std::size_t i = 0; i < n; ++i) {
+      const std::size_t base = i - lanes[i], size = lanes[n + i];
+      std::complex<T> sg_sum(0, 0), sg_prod(1, 0);
+      for (std::size_t j = base; j < base + size; ++j) {
+        sg_sum += static_cast<std::complex<T>>(group_input<T>(j));
+        sg_prod *= static_cast<std::complex<T>>(group_input<T>(j));
+      }
+      pass &= check_results(out[i], std_sum, /*is_device*/ true);
+      pass &= check_results(out[n + i], sg_sum, /*is_device*/ true);
+      pass &= check_results(out[2 * n + i], sg_prod, /*is_device*/ true);
+      std::complex<T> std_out{};
+      std_out = std::complex<T>(0, 1) * sg_prod;
+      pass &= check_results(out[3 * n + i], std_out, /*is_device*/ true);
+    }
+
+    sycl::free(out, Q);
+    sycl::free(lanes, Q);
+
+    return pass;
+  }
+};
+
+template <typename T> struct test_group_scan {
+  bool operator()(sycl::queue &Q, T, T) {
+    bool pass = true;
+    constexpr std::size_t n = 8;
+
+    // inclusive sum, exclusive sum, inclusive product, exclusive product
+    auto *out = sycl::malloc_shared<complex<T>>(4 * n, Q);
+    auto *lanes = sycl::malloc_shared<std::size_t>(n, Q);
+
+    Q.parallel_for(sycl::nd_range<1>(n, n), [=](sycl::nd_item<1> it) {
+       auto sg = it.get_sub_group();
+       const std::size_t i = it.get_global_id(0);
+       lanes[i] = sg.get_local_linear_id();
+       const complex<T> z = group_input<T>(i);
+       out[i] = inclusive_scan_over_group(it.get_group(), z, plus<>());
+       out[n + i] = exclusive_scan_over_group(it.get_group(), z,
+                                              sycl::plus<complex<T>>());
+       out[2 * n + i] = inclusive_scan_over_group(sg, z, multiplies<>());
+       out[3 * n + i] = exclusive_scan_over_group(sg, z, complex<T>(2, 0),
+                                                  multiplies<complex<T>>());
+     }).wait();
+
+    std::complex<T> std_sum(0, 0), std_prod(1, 0);
+    for (std::size_t i = 0; i < n; ++i) {
+      // The sub-group product restarts at each sub-group's first lane.
+      if (lanes[i] == 0)
+        std_prod = std::complex<T>(1, 0);
+      std::complex<T> std_out{};
+      std_out = std_sum;
+      pass &= check_results(out[n + i], std_out, /*is_device*/ true);
+      std_out = std::complex<T>(2, 0) * std_prod;
+      pass &= check_results(out[3 * n + i], std_out, /*is_device*/ true);
+
+      std_sum += static_cast<std::complex<T>>(group_input<T>(i));
+      std_prod *= static_cast<std::complex<T>>(group_input<T>(i));
+      pass &= check_results(out[i], std_sum, /*is_device*/ true);
+      pass &= check_results(out[2 * n + i], std_prod, /*is_device*/ true);
+    }
+
+    sycl::free(out, Q);
+    sycl::free(lanes, Q);
+
+    return pass;
+  }
+};
+
+int main() {
+  sycl::queue Q;
+
+  bool test_passes = true;
+  test_passes &= test_valid_types<test_group_exchange>(Q, 0, 0);
+  test_passes &= test_valid_types<test_group_reduce>(Q, 0, 0);
+  test_passes &= test_valid_types<test_group_scan>(Q, 0, 0);
+
+  if (!test_passes)
+    std::cerr << "complex group algorithms test fails\n";
+
+  return !test_passes;
+}
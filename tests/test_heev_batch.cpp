@@ -0,0 +1,118 @@
+#include "test_helper.hpp"
+
+#include "sycl_ext_complex_lapack.hpp"
+
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+using namespace sycl::ext::cplx;
+
+// A = Q * diag(lambda) * Q^H, Q a unitary DFT matrix with column phases
+// depending on m. Matrix 1 has a repeated eigenvalue.
+template <std::size_t N> double lambda(std::size_t m, std::size_t k) {
+  if (m == 1 && k == 1)
+    k = 0;
+  return 2.0 * double(k) + 1.5 - double(N);
+}
+template <std::size_t N>
+std::complex<double> q_input(std::size_t m, std::size_t i, std::size_t k) {
+  const double pi = 3.14159265358979323846;
+  return std::polar(1 / std::sqrt(double(N)),
+                    2 * pi * double(i * k) / double(N) + double(m + k));
+}
+
+template <typename T, std::size_t N> bool test_size(sycl::queue &Q) {
+  bool pass = true;
+  constexpr std::size_t batch = 3, lda = N + 1, stride = lda * N;
+  // Jacobi accumulates rounding over the sweeps
+  constexpr int tol = 8 * int(N);
+
+  auto *a = sycl::malloc_shared<complex<T>>(batch * stride, Q);
+  auto *w = sycl::malloc_shared<T>(batch * N, Q);
+  std::vector<std::complex<T>> std_a(batch * stride);
+  for (std::size_t m = 0; m < batch; ++m)
+    for (std::size_t i = 0; i < N; ++i)
+      for (std::size_t j = 0; j < N; ++j) {
+        std::complex<double> acc(0, 0);
+        for (std::size_t k = 0; k < N; ++k)
+          acc += q_input<N>(m, i, k) * lambda<N>(m, k) *
+                 std::conj(q_input<N>(m, j, k));
+        // Only the upper triangle is read
+        if (i > j)
+          acc = std::complex<double>(7, 7);
+        std_a[m * stride + i + j * lda] = std::complex<T>(acc);
+      }
+
+  for (auto jobz : {job::novec, job::vec}) {
+    for (std::size_t e = 0; e < batch * stride; ++e)
+      a[e] = std_a[e];
+    heev_batch<N>(Q, jobz, a, lda, stride, w, N, batch).wait();
+
+    for (std::size_t m = 0; m < batch; ++m) {
+      for (std::size_t k = 0; k < N; ++k) {
+        std::complex<T> std_out(T(lambda<N>(m, k)), 0);
+        pass &= check_results(complex<T>(w[m * N + k], 0), std_out,
+                              /*is_device*/ true, tol);
+      }
+      if (jobz == job::novec) {
+        for (std::size_t e = m * stride; e < (m + 1) * stride; ++e)
+          pass &= check_results(a[e], std_a[e], /*is_device*/ true);
+        continue;
+      }
+      // Column k spans the eigenspace of lambda_k: its projection onto the
+      // reference eigenvectors with that eigenvalue has unit length.
+      for (std::size_t k = 0; k < N; ++k) {
+        double proj = 0;
+        for (std::size_t j = 0; j < N; ++j) {
+          if (lambda<N>(m, j) != lambda<N>(m, k))
+            continue;
+          std::complex<double> dot(0, 0);
+          for (std::size_t i = 0; i < N; ++i)
+            dot += std::conj(q_input<N>(m, i, j)) *
+                   std::complex<double>(a[m * stride + i + k * lda].real(),
+                                        a[m * stride + i + k * lda].imag());
+          proj += std::norm(dot);
+        }
+        pass &= check_results(complex<T>(T(proj), 0), std::complex<T>(1, 0),
+                              /*is_device*/ true, tol);
+      }
+    }
+  }
+
+  sycl::free(a, Q);
+  sycl::free(w, Q);
+
+  return pass;
+}
+
+template <typename T> struct test_heev_batch {
+  bool operator()(sycl::queue &Q) {
+    // The batched LAPACK routines cover complex<float> and complex<double>
+    if constexpr (std::is_same_v<T, sycl::half>) {
+      return true;
+    } else {
+      bool pass = true;
+      // Closed forms
+      pass &= test_size<T, 2>(Q);
+      pass &= test_size<T, 3>(Q);
+      // Jacobi
+      pass &= test_size<T, 4>(Q);
+      pass &= test_size<T, 7>(Q);
+      pass &= test_size<T, 16>(Q);
+      return pass;
+    }
+  }
+};
+
+int main() {
+  sycl::queue Q;
+
+  bool test_passes = true;
+  test_passes &= test_valid_types<test_heev_batch>(Q);
+
+  if (!test_passes)
+    std::cerr << "batched Hermitian eigensolver complex test fails\n";
+
+  return !test_passes;
+}
@@ -0,0 +1,198 @@
+#include "test_helper.hpp"
+
+#include "sycl_ext_complex_lapack.hpp"
+
+#include <type_traits>
+#include <vector>
+
+using namespace sycl::ext::cplx;
+
+// A = P^T * L * U with |re| + |im| < 1 below the diagonal of L and powers of
+// two on the diagonal of U, so that partial pivoting recovers exactly L, U
+// and P, and every step is exact.
+template <typename T>
+std::complex<T> l_input(std::size_t m, std::size_t i, std::size_t j) {
+  if (i == j)
+    return std::complex<T>(1, 0);
+  if (i < j)
+    return std::complex<T>(0, 0);
+  const std::complex<T> choices[] = {
+      {0.5, 0}, {-0.25, 0}, {0.25, 0.5}, {0, -0.5}, {0, 0}};
+  return choices[(i + 2 * j + m) % 5];
+}
+template <typename T>
+std::complex<T> u_input(std::size_t m, std::size_t i, std::size_t j) {
+  if (i == j) {
+    const T diagonal[] = {2, -1, 4, 0.5};
+    return std::complex<T>(diagonal[(i + m) % 4], 0);
+  }
+  if (i > j)
+    return std::complex<T>(0, 0);
+  return std::complex<T>(T(int((i + j + m) % 3) - 1), T((i * j) % 2));
+}
+// Row perm[i] of A is row i of L * U
+std::size_t perm(std::size_t n, std::size_t i) { return (i * (n - 1) + 1) % n; }
+
+template <typename T, std::size_t N>
+bool test_size(sycl::queue &Q, bool solve) {
+  bool pass = true;
+  constexpr std::size_t batch = 5, lda = N + 1, stride = lda * N + 2;
+  constexpr std::size_t nrhs = 2, ldb = N + 3, stride_b = ldb * nrhs;
+
+  auto *a = sycl::malloc_shared<complex<T>>(batch * stride, Q);
+  auto *ipiv = sycl::malloc_shared<std::int64_t>(batch * N, Q);
+  auto *info = sycl::malloc_shared<std::int64_t>(batch, Q);
+  auto *det = sycl::malloc_shared<complex<T>>(batch, Q);
+  auto *b = sycl::malloc_shared<complex<T>>(batch * stride_b, Q);
+
+  std::vector<std::complex<T>> std_a(batch * N * N);
+  std::vector<std::complex<T>> std_det(batch);
+  for (std::size_t m = 0; m < batch; ++m) {
+    std::size_t inversions = 0;
+    std_det[m] = std::complex<T>(1, 0);
+    for (std::size_t i = 0; i < N; ++i) {
+      std_det[m] *= u_input<T>(m, i, i);
+      for (std::size_t r = i + 1; r < N; ++r)
+        inversions += perm(N, r) < perm(N, i);
+      for (std::size_t j = 0; j < N; ++j) {
+        std::complex<T> acc(0, 0);
+        for (std::size_t p = 0; p < N; ++p)
+          acc += l_input<T>(m, i, p) * u_input<T>(m, p, j);
+        std_a[(m * N + perm(N, i)) * N + j] = acc;
+      }
+    }
+    if (inversions % 2)
+      std_det[m] = -std_det[m];
+  }
+  auto std_at = [&](std::size_t m, std::size_t i, std::size_t j) {
+    return std_a[(m * N + i) * N + j];
+  };
+  auto load = [&] {
+    for (std::size_t m = 0; m < batch; ++m)
+      for (std::size_t i = 0; i < N; ++i)
+        for (std::size_t j = 0; j < N; ++j)
+          a[m * stride + i + j * lda] = std_at(m, i, j);
+  };
+
+  load();
+  getrf_batch<N>(Q, a, lda, stride, ipiv, N, batch, info).wait();
+
+  for (std::size_t m = 0; m < batch; ++m) {
+    pass &= info[m] == 0;
+    // P^T * L * U from the factors
+    std::vector<std::complex<T>> lu(N * N);
+    for (std::size_t i = 0; i < N; ++i)
+      for (std::size_t j = 0; j < N; ++j)
+        for (std::size_t p = 0; p <= std::min(i, j); ++p) {
+          const std::complex<T> l =
+              p == i ? std::complex<T>(1, 0)
+                     : std::complex<T>(a[m * stride + i + p * lda]);
+          lu[i * N + j] += l * std::complex<T>(a[m * stride + p + j * lda]);
+        }
+    for (std::size_t k = N; k-- > 0;)
+      for (std::size_t j = 0; j < N; ++j)
+        std::swap(lu[k * N + j], lu[(ipiv[m * N + k] - 1) * N + j]);
+    for (std::size_t i = 0; i < N; ++i)
+      for (std::size_t j = 0; j < N; ++j)
+        pass &= check_results(complex<T>(lu[i * N + j]), std_at(m, i, j),
+                              /*is_device*/ true);
+  }
+
+  det_batch<N>(Q, a, lda, stride, ipiv, N, det, batch).wait();
+  for (std::size_t m = 0; m < batch; ++m)
+    pass &= check_results(det[m], std_det[m], /*is_device*/ true);
+
+  if (solve) {
+    for (auto trans :
+         {transpose::nontrans, transpose::trans, transpose::conjtrans}) {
+      // b = op(A) * x for x of small integers
+      auto x_input = [](std::size_t i, std::size_t r) {
+        return std::complex<T>(T((i + r) % 3), T(1) - T(i % 2));
+      };
+      for (std::size_t m = 0; m < batch; ++m)
+        for (std::size_t r = 0; r < nrhs; ++r)
+          for (std::size_t i = 0; i < N; ++i) {
+            std::complex<T> acc(0, 0);
+            for (std::size_t j = 0; j < N; ++j) {
+              std::complex<T> op_a = trans == transpose::nontrans
+                                         ? std_at(m, i, j)
+                                         : std_at(m, j, i);
+              if (trans == transpose::conjtrans)
+                op_a = std::conj(op_a);
+              acc += op_a * x_input(j, r);
+            }
+            b[m * stride_b + r * ldb + i] = acc;
+          }
+      getrs_batch<N>(Q, trans, nrhs, a, lda, stride, ipiv, N, b, ldb,
+                     stride_b, batch)
+          .wait();
+      for (std::size_t m = 0; m < batch; ++m)
+        for (std::size_t r = 0; r < nrhs; ++r)
+          for (std::size_t i = 0; i < N; ++i)
+            pass &= check_results(b[m * stride_b + r * ldb + i], x_input(i, r),
+                                  /*is_device*/ true);
+    }
+
+    // A * inv(A) == I
+    getri_batch<N>(Q, a, lda, stride, ipiv, N, batch).wait();
+    for (std::size_t m = 0; m < batch; ++m)
+      for (std::size_t i = 0; i < N; ++i)
+        for (std::size_t j = 0; j < N; ++j) {
+          std::complex<T> acc(0, 0);
+          for (std::size_t p = 0; p < N; ++p)
+            acc += std_at(m, i, p) *
+                   std::complex<T>(a[m * stride + p + j * lda]);
+          pass &= check_results(complex<T>(acc),
+                                std::complex<T>(i == j ? 1 : 0, 0),
+                                /*is_device*/ true);
+        }
+  }
+
+  // A zero first column is reported as the first zero pivot
+  load();
+  for (std::size_t i = 0; i < N; ++i)
+    a[2 * stride + i] = complex<T>(0, 0);
+  getrf_batch<N>(Q, a, lda, stride, ipiv, N, batch, info).wait();
+  for (std::size_t m = 0; m < batch; ++m)
+    pass &= info[m] == (m == 2 ? 1 : 0);
+
+  sycl::free(a, Q);
+  sycl::free(ipiv, Q);
+  sycl::free(info, Q);
+  sycl::free(det, Q);
+  sycl::free(b, Q);
+
+  return pass;
+}
+
+template <typename T> struct test_lu_batch {
+  bool operator()(sycl::queue &Q) {
+    // The batched LAPACK routines cover complex<float> and complex<double>
+    if constexpr (std::is_same_v<T, sycl::half>) {
+      return true;
+    } else {
+      bool pass = true;
+      pass &= test_size<T, 2>(Q, true);
+      pass &= test_size<T, 3>(Q, true);
+      pass &= test_size<T, 5>(Q, true);
+      pass &= test_size<T, 8>(Q, true);
+      // The 16 x 16 solutions and inverses need more bits than float has
+      pass &= test_size<T, 16>(Q, std::is_same_v<T, double>);
+      // Factors stay exact at any size
+      pass &= test_size<T, 64>(Q, false);
+      return pass;
+    }
+  }
+};
+
+int main() {
+  sycl::queue Q;
+
+  bool test_passes = true;
+  test_passes &= test_valid_types<test_lu_batch>(Q);
+
+  if (!test_passes)
+    std::cerr << "batched LU complex test fails\n";
+
+  return !test_passes;
+}
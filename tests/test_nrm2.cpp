@@ -0,0 +1,72 @@
+#include "test_helper.hpp"
+
+#include "sycl_ext_complex_blas.hpp"
+
+#include <limits>
+
+using namespace sycl::ext::cplx;
+
+// Fills x with n values whose components all have magnitude a and returns
+// the norm, sqrt(2 n) a.
+template <typename T> T fill_constant(complex<T> *x, std::size_t n, T a) {
+  for (std::size_t i = 0; i < n; ++i)
+    x[i] = complex<T>(i % 2 ? a : -a, a);
+  return T(std::sqrt(2.0L * n) * static_cast<long double>(a));
+}
+
+template <typename T> struct test_nrm2 {
+  bool operator()(sycl::queue &Q, T init_re, T init_im) {
+    bool pass = true;
+    constexpr std::size_t n = 200;
+
+    auto *x = sycl::malloc_shared<complex<T>>(2 * n, Q);
+    auto *result = sycl::malloc_shared<T>(1, Q);
+
+    // Mid-range values, every other element
+    long double std_sum = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      x[2 * i] = complex<T>(init_re * T(i % 4), init_im);
+      x[2 * i + 1] = complex<T>(1000, 1000);
+      std_sum += std::norm(std::complex<long double>(
+          static_cast<long double>(x[2 * i].real()),
+          static_cast<long double>(x[2 * i].imag())));
+    }
+    nrm2(Q, n, x, 2, result).wait();
+    pass &= check_results(*result, T(std::sqrt(std_sum)), /*is_device*/ true);
+
+    // Squares would overflow
+    T std_out = fill_constant(x, n, std::numeric_limits<T>::max() / T(32));
+    nrm2(Q, n, x, 1, result).wait();
+    pass &= check_results(*result, std_out, /*is_device*/ true);
+
+    // Squares would underflow
+    std_out = fill_constant(x, n, std::numeric_limits<T>::min() * T(4));
+    nrm2(Q, n, x, 1, result).wait();
+    pass &= check_results(*result, std_out, /*is_device*/ true);
+
+    // NaN propagates, n == 0 gives 0
+    x[7] = complex<T>(std::numeric_limits<T>::quiet_NaN(), 0);
+    nrm2(Q, n, x, 1, result).wait();
+    pass &= check_results(*result, std::numeric_limits<T>::quiet_NaN(),
+                          /*is_device*/ true);
+    nrm2(Q, 0, x, 1, result).wait();
+    pass &= check_results(*result, T(0), /*is_device*/ true);
+
+    sycl::free(x, Q);
+    sycl::free(result, Q);
+
+    return pass;
+  }
+};
+
+int main() {
+  sycl::queue Q;
+
+  bool test_passes = true;
+  test_passes &= test_valid_types<test_nrm2>(Q, 0.5, -1.25);
+
+  if (!test_passes)
+    std::cerr << "nrm2 complex test fails\n";
+
+  return !test_passes;
+}
@@ -0,0 +1,102 @@
+#include "test_helper.hpp"
+
+using namespace sycl::ext::cplx;
+
+template <typename T> struct test_known_identity {
+  bool operator()(sycl::queue &, T, T) {
+    static_assert(
+        sycl::has_known_identity_v<sycl::plus<complex<T>>, complex<T>>);
+    static_assert(sycl::has_known_identity_v<sycl::plus<>, complex<T>>);
+    static_assert(
+        sycl::has_known_identity_v<sycl::multiplies<complex<T>>, complex<T>>);
+    static_assert(sycl::has_known_identity_v<sycl::multiplies<>, complex<T>>);
+
+    bool pass = true;
+
+    std::complex<T> std_zero(0, 0), std_one(1, 0);
+    pass &= check_results(
+        sycl::known_identity_v<sycl::plus<complex<T>>, complex<T>>, std_zero,
+        /*is_device*/ false);
+    pass &= check_results(sycl::known_identity_v<sycl::plus<>, complex<T>>,
+                          std_zero, /*is_device*/ false);
+    pass &= check_results(
+        sycl::known_identity_v<sycl::multiplies<complex<T>>, complex<T>>,
+        std_one, /*is_device*/ false);
+    pass &= check_results(
+        sycl::known_identity_v<sycl::multiplies<>, complex<T>>, std_one,
+        /*is_device*/ false);
+
+    return pass;
+  }
+};
+
+template <typename T> struct test_reduce_plus {
+  bool operator()(sycl::queue &Q, T init_re, T init_im) {
+    bool pass = true;
+    constexpr std::size_t n = 64;
+
+    auto *in = sycl::malloc_shared<complex<T>>(n, Q);
+    auto *sum = sycl::malloc_shared<complex<T>>(1, Q);
+    for (std::size_t i = 0; i < n; ++i)
+      in[i] = complex<T>(init_re, init_im * T(i % 2 ? 1 : -1));
+    *sum = complex<T>(0, 0);
+
+    Q.submit([&](sycl::handler &h) {
+       h.parallel_for(sycl::range<1>(n),
+                      sycl::reduction(sum, sycl::plus<complex<T>>()),
+                      [=](sycl::id<1> i, auto &red) { red += in[i]; });
+     }).wait();
+
+    std::complex<T> std_out{};
+    std_out = std::complex<T>(T(n) * init_re, 0);
+    pass &= check_results(*sum, std_out, /*is_device*/ true);
+
+    sycl::free(in, Q);
+    sycl::free(sum, Q);
+
+    return pass;
+  }
+};
+
+template <typename T> struct test_reduce_multiplies {
+  bool operator()(sycl::queue &Q, T init_re, T init_im) {
+    bool pass = true;
+    constexpr std::size_t n = 4;
+
+    auto *in = sycl::malloc_shared<complex<T>>(n, Q);
+    auto *prod = sycl::malloc_shared<complex<T>>(1, Q);
+    std::complex<T> std_out(1, 0);
+    for (std::size_t i = 0; i < n; ++i) {
+      in[i] = complex<T>(init_re, init_im);
+      std_out *= init_std_complex(init_re, init_im);
+    }
+    *prod = complex<T>(1, 0);
+
+    Q.submit([&](sycl::handler &h) {
+       h.parallel_for(sycl::range<1>(n),
+                      sycl::reduction(prod, sycl::multiplies<>()),
+                      [=](sycl::id<1> i, auto &red) { red *= in[i]; });
+     }).wait();
+
+    pass &= check_results(*prod, std_out, /*is_device*/ true);
+
+    sycl::free(in, Q);
+    sycl::free(prod, Q);
+
+    return pass;
+  }
+};
+
+int main() {
+  sycl::queue Q;
+
+  bool test_passes = true;
+  test_passes &= test_valid_types<test_known_identity>(Q, 0, 0);
+  test_passes &= test_valid_types<test_reduce_plus>(Q, 0.5, 1.5);
+  test_passes &= test_valid_types<test_reduce_multiplies>(Q, 0.5, 0.25);
+
+  if (!test_passes)
+    std::cerr << "complex reduction test fails\n";
+
+  return !test_passes;
+}
@@ -0,0 +1,119 @@
+#include "test_helper.hpp"
+
+#include "sycl_ext_complex_algorithm.hpp"
+
+using namespace sycl::ext::cplx;
+
+// Small integers and unit phasors keep every partial sum and product exact,
+// whatever order the scan combines them in.
+template <typename T> complex<T> sum_input(std::size_t i) {
+  return complex<T>(T(i % 3), -T(i % 2));
+}
+
+template <typename T> complex<T> phasor_input(std::size_t i) {
+  switch (i % 5) {
+  case 0:
+    return complex<T>(0, 1);
+  case 1:
+    return complex<T>(0, -1);
+  case 2:
+    return complex<T>(-1, 0);
+  default:
+    return complex<T>(1, 0);
+  }
+}
+
+template <typename T> struct test_inclusive_scan_plus {
+  bool operator()(sycl::queue &Q, T, T) {
+    bool pass = true;
+    // Small enough for half, large enough to span several tiles
+    constexpr std::size_t n = 1500;
+
+    auto *in = sycl::malloc_shared<complex<T>>(n, Q);
+    auto *out = sycl::malloc_shared<complex<T>>(n, Q);
+    for (std::size_t i = 0; i < n; ++i)
+      in[i] = sum_input<T>(i);
+
+    inclusive_scan(Q, in, out, n, op::plus).wait();
+
+    std::complex<T> std_out(0, 0);
+    for (std::size_t i = 0; i < n; ++i) {
+      std_out += static_cast<std::complex<T>>(sum_input<T>(i));
+      pass &= check_results(out[i], std_out, /*is_device*/ true);
+    }
+
+    sycl::free(in, Q);
+    sycl::free(out, Q);
+
+    return pass;
+  }
+};
+
+template <typename T> struct test_exclusive_scan_plus {
+  bool operator()(sycl::queue &Q, T, T) {
+    bool pass = true;
+    constexpr std::size_t n = 1500;
+
+    // In place
+    auto *data = sycl::malloc_shared<complex<T>>(n, Q);
+    for (std::size_t i = 0; i < n; ++i)
+      data[i] = sum_input<T>(i);
+
+    exclusive_scan(Q, data, data, n, complex<T>(2, 2), op::plus).wait();
+
+    std::complex<T> std_out(2, 2);
+    for (std::size_t i = 0; i < n; ++i) {
+      pass &= check_results(data[i], std_out, /*is_device*/ true);
+      std_out += static_cast<std::complex<T>>(sum_input<T>(i));
+    }
+
+    sycl::free(data, Q);
+
+    return pass;
+  }
+};
+
+template <typename T> struct test_scan_multiplies {
+  bool operator()(sycl::queue &Q, T, T) {
+    bool pass = true;
+    constexpr std::size_t n = 5000;
+
+    auto *in = sycl::malloc_shared<complex<T>>(n, Q);
+    auto *out = sycl::malloc_shared<complex<T>>(n, Q);
+    auto *out_lr = sycl::malloc_shared<complex<T>>(n, Q);
+    for (std::size_t i = 0; i < n; ++i)
+      in[i] = phasor_input<T>(i);
+
+    auto e = inclusive_scan(Q, in, out, n, op::multiplies);
+    exclusive_scan(Q, in, out_lr, n, complex<T>(1, 0),
+                   op::limited_range_multiplies, {e})
+        .wait();
+
+    std::complex<T> std_out(1, 0);
+    for (std::size_t i = 0; i < n; ++i) {
+      pass &= check_results(out_lr[i], std_out, /*is_device*/ true);
+      std_out *= static_cast<std::complex<T>>(phasor_input<T>(i));
+      pass &= check_results(out[i], std_out, /*is_device*/ true);
+    }
+
+    sycl::free(in, Q);
+    sycl::free(out, Q);
+    sycl::free(out_lr, Q);
+
+    return pass;
+  }
+};
+
+int main() {
+  sycl::queue Q;
+
+  bool test_passes = true;
+  test_passes &= test_valid_types<test_inclusive_scan_plus>(Q, 0, 0);
+  test_passes &= test_valid_types<test_exclusive_scan_plus>(Q, 0, 0);
+  test_passes &= test_valid_types<test_scan_multiplies>(Q, 0, 0);
+
+  if (!test_passes)
+    std::cerr << "complex scan test fails\n";
+
+  return !test_passes;
+}
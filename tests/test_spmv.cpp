@@ -0,0 +1,179 @@
+#include "test_helper.hpp"
+
+#include "sycl_ext_complex_sparse.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+using namespace sycl::ext::cplx;
+
+constexpr std::size_t rows = 150, cols = 90, slice = 8;
+
+// Irregular rows: some empty, two much longer than the rest
+std::size_t row_length(std::size_t i) {
+  return i == 40 || i == 41 ? 80 : (i * 7) % 11;
+}
+std::size_t column(std::size_t i, std::size_t p) {
+  return (i * 3 + 7 * p) % cols;
+}
+template <typename T> std::complex<T> value(std::size_t i, std::size_t p) {
+  return std::complex<T>(T(p % 3), T(int(i % 2) - 1));
+}
+template <typename T> std::complex<T> x_input(std::size_t j) {
+  return std::complex<T>(T(j % 4), T(1) - T(j % 2));
+}
+
+template <typename T> struct test_spmv {
+  bool operator()(sycl::queue &Q, T init_re, T init_im) {
+    // Sparse products scatter with atomic_add, which has no half
+    if constexpr (std::is_same_v<T, sycl::half>) {
+      return true;
+    } else {
+      bool pass = true;
+
+      // CSR
+      std::size_t nnz = 0, width = 0;
+      for (std::size_t i = 0; i < rows; ++i) {
+        nnz += row_length(i);
+        width = std::max(width, row_length(i));
+      }
+      auto *row_ptr = sycl::malloc_shared<int>(rows + 1, Q);
+      auto *col_ind = sycl::malloc_shared<int>(nnz, Q);
+      auto *values = sycl::malloc_shared<complex<T>>(nnz, Q);
+      row_ptr[0] = 0;
+      for (std::size_t i = 0; i < rows; ++i) {
+        for (std::size_t p = 0; p < row_length(i); ++p) {
+          col_ind[row_ptr[i] + p] = int(column(i, p));
+          values[row_ptr[i] + p] = value<T>(i, p);
+        }
+        row_ptr[i + 1] = row_ptr[i] + int(row_length(i));
+      }
+
+      // ELLPACK with a padded leading dimension
+      constexpr std::size_t ld = rows + 2;
+      auto *ell_col = sycl::malloc_shared<int>(width * ld, Q);
+      auto *ell_val = sycl::malloc_shared<complex<T>>(width * ld, Q);
+      for (std::size_t i = 0; i < rows; ++i)
+        for (std::size_t p = 0; p < width; ++p) {
+          const bool pad = p >= row_length(i);
+          ell_col[p * ld + i] = pad ? -1 : int(column(i, p));
+          ell_val[p * ld + i] = pad ? std::complex<T>() : value<T>(i, p);
+        }
+
+      // Sliced ELLPACK, the last slice partly filled
+      constexpr std::size_t slices = (rows + slice - 1) / slice;
+      auto *slice_ptr = sycl::malloc_shared<int>(slices + 1, Q);
+      slice_ptr[0] = 0;
+      for (std::size_t s = 0; s < slices; ++s) {
+        std::size_t w = 0;
+        for (std::size_t i = s * slice; i < std::min(rows, (s + 1) * slice);
+             ++i)
+          w = std::max(w, row_length(i));
+        slice_ptr[s + 1] = slice_ptr[s] + int(w * slice);
+      }
+      auto *sell_col = sycl::malloc_shared<int>(slice_ptr[slices], Q);
+      auto *sell_val = sycl::malloc_shared<complex<T>>(slice_ptr[slices], Q);
+      for (std::size_t s = 0; s < slices; ++s) {
+        const std::size_t w = (slice_ptr[s + 1] - slice_ptr[s]) / slice;
+        for (std::size_t r = 0; r < slice; ++r)
+          for (std::size_t p = 0; p < w; ++p) {
+            const std::size_t i = s * slice + r;
+            const std::size_t at = slice_ptr[s] + p * slice + r;
+            const bool pad = i >= rows || p >= row_length(i);
+            sell_col[at] = pad ? -1 : int(column(i, p));
+            sell_val[at] = pad ? std::complex<T>() : value<T>(i, p);
+          }
+      }
+
+      auto *x = sycl::malloc_shared<complex<T>>(rows, Q);
+      auto *y = sycl::malloc_shared<complex<T>>(rows, Q);
+      for (std::size_t j = 0; j < rows; ++j)
+        x[j] = x_input<T>(j);
+
+      const complex<T> alpha(init_re, init_im), beta(1, -1);
+      const std::complex<T> std_alpha(init_re, init_im), std_beta(1, -1);
+
+      for (auto trans :
+           {transpose::nontrans, transpose::trans, transpose::conjtrans}) {
+        const bool nontrans = trans == transpose::nontrans;
+        const std::size_t out = nontrans ? rows : cols;
+        std::vector<std::complex<T>> std_ax(out);
+        for (std::size_t i = 0; i < rows; ++i)
+          for (std::size_t p = 0; p < row_length(i); ++p) {
+            std::complex<T> a = value<T>(i, p);
+            if (trans == transpose::conjtrans)
+              a = std::conj(a);
+            if (nontrans)
+              std_ax[i] += a * x_input<T>(column(i, p));
+            else
+              std_ax[column(i, p)] += a * x_input<T>(i);
+          }
+
+        for (int kernel = 0; kernel < 4; ++kernel) {
+          // The atomic paths need 64-bit atomics for complex<double>
+          if (std::is_same_v<T, double> && (!nontrans || kernel == 1) &&
+              !Q.get_device().has(sycl::aspect::atomic64))
+            continue;
+          auto run = [&](complex<T> beta) {
+            if (kernel == 0)
+              return csr_gemv(Q, trans, rows, cols, nnz, alpha, row_ptr,
+                              col_ind, values, x, beta, y);
+            if (kernel == 1)
+              return csr_gemv(Q, trans, rows, cols, nnz, alpha, row_ptr,
+                              col_ind, values, x, beta, y,
+                              spmv_algorithm::merge_path);
+            if (kernel == 2)
+              return ell_gemv(Q, trans, rows, cols, width, alpha, ell_col,
+                              ell_val, ld, x, beta, y);
+            return sell_gemv(Q, trans, rows, cols, slice, alpha, slice_ptr,
+                             sell_col, sell_val, x, beta, y);
+          };
+
+          // beta == 0 must not read y
+          for (std::size_t i = 0; i < out; ++i)
+            y[i] = complex<T>(std::numeric_limits<T>::quiet_NaN(), 0);
+          run(complex<T>(0, 0)).wait();
+          std::vector<std::complex<T>> std_y(out);
+          for (std::size_t i = 0; i < out; ++i) {
+            std_y[i] = std_alpha * std_ax[i];
+            pass &= check_results(y[i], std_y[i], /*is_device*/ true);
+          }
+
+          run(beta).wait();
+          for (std::size_t i = 0; i < out; ++i) {
+            std::complex<T> std_out =
+                std_alpha * std_ax[i] + std_beta * std_y[i];
+            pass &= check_results(y[i], std_out, /*is_device*/ true);
+          }
+        }
+      }
+
+      sycl::free(row_ptr, Q);
+      sycl::free(col_ind, Q);
+      sycl::free(values, Q);
+      sycl::free(ell_col, Q);
+      sycl::free(ell_val, Q);
+      sycl::free(slice_ptr, Q);
+      sycl::free(sell_col, Q);
+      sycl::free(sell_val, Q);
+      sycl::free(x, Q);
+      sycl::free(y, Q);
+
+      return pass;
+    }
+  }
+};
+
+int main() {
+  sycl::queue Q;
+
+  bool test_passes = true;
+  test_passes &= test_valid_types<test_spmv>(Q, 1.0, -1.0);
+
+  if (!test_passes)
+    std::cerr << "spmv complex test fails\n";
+
+  return !test_passes;
+}
@@ -0,0 +1,94 @@
+#include "test_helper.hpp"
+
+#include "sycl_ext_complex_view.hpp"
+
+#include <vector>
+
+using namespace sycl::ext::cplx;
+
+static_assert(std::is_same_v<complex<float> *,
+                             decltype(as_cplx(std::declval<
+                                              std::complex<float> *>()))>);
+static_assert(std::is_same_v<const std::complex<double> *,
+                             decltype(as_std(std::declval<
+                                             const complex<double> *>()))>);
+
+template <typename T> struct test_usm_interop {
+  bool operator()(sycl::queue &Q, T init_re, T init_im) {
+    bool pass = true;
+    constexpr std::size_t n = 8;
+
+    // Host code fills std::complex, the kernel reads cplx::complex in place
+    auto *data = sycl::malloc_shared<std::complex<T>>(n, Q);
+    for (std::size_t i = 0; i < n; ++i)
+      data[i] = std::complex<T>(init_re + T(i), init_im);
+
+    complex<T> *cplx_data = as_cplx(data);
+    Q.parallel_for(sycl::range<1>(n), [=](sycl::id<1> i) {
+       cplx_data[i] = sycl::ext::cplx::exp(cplx_data[i]);
+     }).wait();
+
+    for (std::size_t i = 0; i < n; ++i) {
+      std::complex<T> std_out =
+          std::exp(std::complex<T>(init_re + T(i), init_im));
+      pass &= check_results(cplx_data[i], std_out, /*is_device*/ true);
+      pass &= as_std(cplx_data) + i == &data[i];
+    }
+
+    // Strided views accept std::complex storage directly
+    auto view = make_complex_view(data, n / 2, 2).transpose();
+    pass &= view.data() == cplx_data && &view(1, 0) == cplx_data + 1;
+
+    sycl::free(data, Q);
+
+    return pass;
+  }
+};
+
+template <typename T> struct test_buffer_interop {
+  bool operator()(sycl::queue &Q, T init_re, T init_im) {
+    bool pass = true;
+    constexpr std::size_t n = 8;
+
+    std::vector<std::complex<T>> data(n);
+    for (std::size_t i = 0; i < n; ++i)
+      data[i] = std::complex<T>(init_re, init_im - T(i));
+
+    {
+      sycl::buffer<std::complex<T>, 1> std_buf(data.data(), sycl::range<1>(n));
+      auto cplx_buf = as_cplx(std_buf);
+
+      Q.submit([&](sycl::handler &CGH) {
+        sycl::accessor acc(cplx_buf, CGH);
+        CGH.parallel_for(sycl::range<1>(n), [=](sycl::id<1> i) {
+          acc[i] = sycl::ext::cplx::sqrt(acc[i]);
+        });
+      });
+    }
+
+    for (std::size_t i = 0; i < n; ++i) {
+      std::complex<T> std_out =
+          std::sqrt(std::complex<T>(init_re, init_im - T(i)));
+      pass &= check_results(complex<T>(data[i]), std_out, /*is_device*/ true);
+    }
+
+    return pass;
+  }
+};
+
+int main() {
+  sycl::queue Q;
+
+  bool test_passes = true;
+
+  // std::complex only guarantees its layout for float, double and long double
+  test_passes &= test_usm_interop<double>()(Q, 0.42, -1.1);
+  test_passes &= test_usm_interop<float>()(Q, 0.42, -1.1);
+  test_passes &= test_buffer_interop<double>()(Q, 1.5, 2.5);
+  test_passes &= test_buffer_interop<float>()(Q, 1.5, 2.5);
+
+  if (!test_passes)
+    std::cerr << "std::complex interop test fails\n";
+
+  return !test_passes;
+}
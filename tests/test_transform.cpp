@@ -0,0 +1,162 @@
+#include "test_helper.hpp"
+
+#include "sycl_ext_complex_algorithm.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+using namespace sycl::ext::cplx;
+
+#define test_unary_transform(name, func)                                       \
+  template <typename T> struct name {                                          \
+    bool operator()(sycl::queue &Q, T init_re, T init_im) {                    \
+      bool pass = true;                                                        \
+      constexpr std::size_t n = 2000;                                          \
+                                                                               \
+      auto *in = sycl::malloc_shared<complex<T>>(n, Q);                        \
+      auto *out = sycl::malloc_shared<complex<T>>(n, Q);                       \
+      for (std::size_t i = 0; i < n; ++i)                                      \
+        in[i] = complex<T>(init_re, init_im * T(i % 7));                       \
+                                                                               \
+      transform(Q, in, out, n, op::func).wait();                               \
+                                                                               \
+      for (std::size_t i = 0; i < n; ++i) {                                    \
+        std::complex<T> std_out{};                                             \
+        std_out = std::func(init_std_complex(init_re, init_im * T(i % 7)));    \
+        pass &= check_results(out[i], std_out, /*is_device*/ true);            \
+      }                                                                        \
+                                                                               \
+      sycl::free(in, Q);                                                       \
+      sycl::free(out, Q);                                                      \
+                                                                               \
+      return pass;                                                             \
+    }                                                                          \
+  };
+
+test_unary_transform(test_transform_exp, exp);
+test_unary_transform(test_transform_sqrt, sqrt);
+test_unary_transform(test_transform_acosh, acosh);
+test_unary_transform(test_transform_conj, conj);
+
+#undef test_unary_transform
+
+template <typename T> struct test_transform_abs {
+  bool operator()(sycl::queue &Q, T init_re, T init_im) {
+    bool pass = true;
+    constexpr std::size_t n = 100;
+
+    auto *in = sycl::malloc_shared<complex<T>>(n, Q);
+    auto *out = sycl::malloc_shared<T>(n, Q);
+    for (std::size_t i = 0; i < n; ++i)
+      in[i] = complex<T>(init_re * T(i % 5), init_im);
+
+    transform(Q, in, out, n, op::abs).wait();
+
+    for (std::size_t i = 0; i < n; ++i) {
+      T std_out = std::abs(init_std_complex(init_re * T(i % 5), init_im));
+      pass &= check_results(out[i], std_out, /*is_device*/ true);
+    }
+
+    sycl::free(in, Q);
+    sycl::free(out, Q);
+
+    return pass;
+  }
+};
+
+template <typename T> struct test_transform_binary {
+  bool operator()(sycl::queue &Q, T init_re, T init_im) {
+    bool pass = true;
+    constexpr std::size_t n = 300;
+
+    auto *in1 = sycl::malloc_shared<complex<T>>(n, Q);
+    auto *in2 = sycl::malloc_shared<complex<T>>(n, Q);
+    auto *out = sycl::malloc_shared<complex<T>>(n, Q);
+    auto *prod = sycl::malloc_shared<complex<T>>(n, Q);
+    for (std::size_t i = 0; i < n; ++i) {
+      in1[i] = complex<T>(init_re, init_im);
+      in2[i] = complex<T>(init_im, T(i % 3));
+    }
+
+    // Chain the two launches through the returned event
+    auto e = transform(Q, in1, in2, out, n, op::pow);
+    transform(Q, out, in2, prod, n, op::multiplies, {e}).wait();
+
+    for (std::size_t i = 0; i < n; ++i) {
+      auto std_in1 = init_std_complex(init_re, init_im);
+      auto std_in2 = init_std_complex(init_im, T(i % 3));
+      std::complex<T> std_out{};
+      std_out = std::pow(std_in1, std_in2);
+      pass &= check_results(out[i], std_out, /*is_device*/ true);
+      std_out = static_cast<std::complex<T>>(out[i]) *
+                static_cast<std::complex<T>>(in2[i]);
+      pass &= check_results(prod[i], std_out, /*is_device*/ true);
+    }
+
+    sycl::free(in1, Q);
+    sycl::free(in2, Q);
+    sycl::free(out, Q);
+    sycl::free(prod, Q);
+
+    return pass;
+  }
+};
+
+template <typename T> struct test_transform_buffer {
+  bool operator()(sycl::queue &Q, T init_re, T init_im) {
+    bool pass = true;
+    constexpr std::size_t n = 50;
+
+    std::vector<complex<T>> in(n, complex<T>(init_re, init_im));
+    std::vector<complex<T>> out(n);
+    {
+      sycl::buffer<complex<T>, 1> in_buf(in.data(), sycl::range<1>(n));
+      sycl::buffer<complex<T>, 1> out_buf(out.data(), sycl::range<1>(n));
+      transform(Q, in_buf, in_buf, out_buf, op::divides);
+      transform(Q, out_buf, out_buf, op::log);
+    }
+
+    std::complex<T> std_out{};
+    std_out = std::log(std::complex<T>(1, 0));
+    for (std::size_t i = 0; i < n; ++i)
+      pass &= check_results(out[i], std_out, /*is_device*/ true);
+
+    // Inputs shorter than out are rejected before anything is submitted
+    {
+      sycl::buffer<complex<T>, 1> in_buf(in.data(), sycl::range<1>(n - 1));
+      sycl::buffer<complex<T>, 1> out_buf(out.data(), sycl::range<1>(n));
+      bool unary_thrown = false, binary_thrown = false;
+      try {
+        transform(Q, in_buf, out_buf, op::log);
+      } catch (const std::invalid_argument &) {
+        unary_thrown = true;
+      }
+      try {
+        transform(Q, out_buf, in_buf, out_buf, op::divides);
+      } catch (const std::invalid_argument &) {
+        binary_thrown = true;
+      }
+      pass &= unary_thrown && binary_thrown;
+    }
+
+    return pass;
+  }
+};
+
+int main() {
+  sycl::queue Q;
+
+  bool test_passes = true;
+  test_passes &= test_valid_types<test_transform_exp>(Q, 0.42, 1.1);
+  test_passes &= test_valid_types<test_transform_sqrt>(Q, -2.5, 0.3);
+  test_passes &= test_valid_types<test_transform_acosh>(Q, 1.42, -0.2);
+  test_passes &= test_valid_types<test_transform_conj>(Q, 0.42, 1.1);
+  test_passes &= test_valid_types<test_transform_abs>(Q, 3.0, -4.0);
+  test_passes &= test_valid_types<test_transform_binary>(Q, 1.2, 0.4);
+  test_passes &= test_valid_types<test_transform_buffer>(Q, 1.2, 0.4);
+
+  if (!test_passes)
+    std::cerr << "transform complex test fails\n";
+
+  return !test_passes;
+}
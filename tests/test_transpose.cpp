@@ -0,0 +1,103 @@
+#include "test_helper.hpp"
+
+#include "sycl_ext_complex_transpose.hpp"
+
+#include <vector>
+
+using namespace sycl::ext::cplx;
+
+template <typename T>
+std::complex<T> input(std::size_t m, std::size_t i, std::size_t j) {
+  return std::complex<T>(T(i + 2 * m), T(int(j) - 3));
+}
+// Element (i, j) of alpha * op(M) for M(i, j) = input(m, i, j)
+template <typename T>
+std::complex<T> expected(std::complex<T> alpha, std::size_t m, transpose trans,
+                         std::size_t i, std::size_t j) {
+  std::complex<T> std_out{};
+  if (trans == transpose::nontrans)
+    std_out = alpha * input<T>(m, i, j);
+  else if (trans == transpose::trans)
+    std_out = alpha * input<T>(m, j, i);
+  else
+    std_out = alpha * std::conj(input<T>(m, j, i));
+  return std_out;
+}
+
+template <typename T> struct test_transpose {
+  bool operator()(sycl::queue &Q, T init_re, T init_im) {
+    bool pass = true;
+    constexpr std::size_t batch = 3, size = 80 * 80;
+
+    auto *a = sycl::malloc_shared<complex<T>>(batch * size, Q);
+    auto *b = sycl::malloc_shared<complex<T>>(batch * size, Q);
+
+    const std::complex<T> std_alphas[] = {{1, 0}, {init_re, init_im}};
+    for (auto l : {layout::row_major, layout::col_major}) {
+      for (auto trans :
+           {transpose::nontrans, transpose::trans, transpose::conjtrans}) {
+        for (const auto &std_alpha : std_alphas) {
+          const complex<T> alpha(std_alpha.real(), std_alpha.imag());
+          // rows x cols, square in place, then not square in place
+          const std::size_t shapes[][4] = {
+              {70, 45, 73, 75}, {70, 70, 71, 71}, {33, 64, 65, 70}};
+          for (std::size_t s = 0; s < 3; ++s) {
+            const std::size_t rows = shapes[s][0], cols = shapes[s][1];
+            const std::size_t lda = shapes[s][2], ldb = shapes[s][3];
+            const bool nontrans = trans == transpose::nontrans;
+            const std::size_t out_rows = nontrans ? rows : cols;
+            const std::size_t out_cols = nontrans ? cols : rows;
+            auto at = [&](std::size_t m, std::size_t i, std::size_t j,
+                          std::size_t ld) {
+              return m * size +
+                     (l == layout::row_major ? i * ld + j : i + j * ld);
+            };
+
+            for (std::size_t m = 0; m < batch; ++m)
+              for (std::size_t i = 0; i < rows; ++i)
+                for (std::size_t j = 0; j < cols; ++j)
+                  a[at(m, i, j, lda)] = input<T>(m, i, j);
+
+            if (s == 0) {
+              omatcopy(Q, l, trans, rows, cols, alpha, a, lda, b, ldb).wait();
+              omatcopy_batch(Q, l, trans, rows, cols, alpha, a + size, lda,
+                             size, b + size, ldb, size, batch - 1)
+                  .wait();
+            } else {
+              imatcopy(Q, l, trans, rows, cols, alpha, a, lda, ldb).wait();
+              imatcopy_batch(Q, l, trans, rows, cols, alpha, a + size, lda,
+                             ldb, size, batch - 1)
+                  .wait();
+            }
+
+            const complex<T> *out = s == 0 ? b : a;
+            for (std::size_t m = 0; m < batch; ++m)
+              for (std::size_t i = 0; i < out_rows; ++i)
+                for (std::size_t j = 0; j < out_cols; ++j)
+                  pass &= check_results(
+                      out[at(m, i, j, ldb)],
+                      expected<T>(std_alpha, m, trans, i, j),
+                      /*is_device*/ true);
+          }
+        }
+      }
+    }
+
+    sycl::free(a, Q);
+    sycl::free(b, Q);
+
+    return pass;
+  }
+};
+
+int main() {
+  sycl::queue Q;
+
+  bool test_passes = true;
+  test_passes &= test_valid_types<test_transpose>(Q, 1.0, -1.0);
+
+  if (!test_passes)
+    std::cerr << "transpose complex test fails\n";
+
+  return !test_passes;
+}
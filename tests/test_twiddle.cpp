@@ -0,0 +1,71 @@
+#include "test_helper.hpp"
+
+#include "sycl_ext_complex_fft.hpp"
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+using namespace sycl::ext::cplx;
+
+template <typename T> struct test_twiddle_table {
+  bool operator()(sycl::queue &Q) {
+    if constexpr (std::is_same_v<T, sycl::half>) {
+      return true;
+    } else {
+      bool pass = true;
+      const long double pi = 3.141592653589793238462643383279502884L;
+      const T tol = 4 * std::numeric_limits<T>::epsilon();
+
+      for (std::size_t n : {1, 6, 7, 64, 1000}) {
+        for (bool forward : {true, false}) {
+          const auto dir =
+              forward ? fft_direction::forward : fft_direction::backward;
+          const complex<T> *table = twiddle_table<T>(Q, n, dir);
+
+          std::vector<complex<T>> host(n);
+          Q.memcpy(host.data(), table, n * sizeof(complex<T>)).wait();
+          for (std::size_t k = 0; k < n; ++k) {
+            const long double angle = 2 * pi * k / n;
+            const T re = T(std::cos(angle));
+            const T im = T(forward ? -std::sin(angle) : std::sin(angle));
+            if (std::abs(host[k].real() - re) > tol ||
+                std::abs(host[k].imag() - im) > tol) {
+              std::cerr << "Test failed with complex_type: "
+                        << get_typename<T>() << " n " << n << " k " << k
+                        << " Output: " << host[k] << std::endl;
+              pass = false;
+            }
+          }
+
+          // Cached per length and direction
+          pass &= twiddle_table<T>(Q, n, dir) == table;
+        }
+        pass &= twiddle_table<T>(Q, n, fft_direction::forward) !=
+                twiddle_table<T>(Q, n, fft_direction::backward);
+      }
+
+      // Tables are regenerated after a release
+      release_twiddle_tables();
+      const complex<T> *table = twiddle_table<T>(Q, 4, fft_direction::forward);
+      complex<T> w;
+      Q.memcpy(&w, table + 1, sizeof(w)).wait();
+      pass &= w.real() == T(0) && w.imag() == T(-1);
+      release_twiddle_tables();
+
+      return pass;
+    }
+  }
+};
+
+int main() {
+  sycl::queue Q;
+
+  bool test_passes = true;
+  test_passes &= test_valid_types<test_twiddle_table>(Q);
+
+  if (!test_passes)
+    std::cerr << "twiddle_table complex test fails\n";
+
+  return !test_passes;
+}
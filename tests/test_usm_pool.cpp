@@ -0,0 +1,107 @@
+#include "test_helper.hpp"
+
+#include "sycl_ext_complex_usm.hpp"
+
+#include <limits>
+#include <new>
+#include <vector>
+
+using namespace sycl::ext::cplx;
+
+template <typename T> struct test_pool_reuse {
+  bool operator()(sycl::queue &Q, T init_re, T init_im) {
+    bool pass = true;
+    usm_pool pool(Q, sycl::usm::alloc::shared);
+
+    std::complex<T> std_out{};
+    std_out = std::exp(init_std_complex(init_re, init_im));
+
+    // The per-test pattern of one allocation per case only hits USM once
+    for (int i = 0; i < 10; ++i) {
+      auto *cplx_out = pool.allocate<complex<T>>(1);
+      Q.single_task([=]() {
+         cplx_out[0] = sycl::ext::cplx::exp(complex<T>(init_re, init_im));
+       }).wait();
+      pass &= check_results(cplx_out[0], std_out, /*is_device*/ true);
+      pool.deallocate(cplx_out, 1);
+    }
+
+    // Requests in the same size class share blocks
+    auto *a = pool.allocate<complex<T>>(3);
+    pool.deallocate(a, 3);
+    auto *b = pool.allocate<complex<T>>(5);
+    pass &= a == b;
+    pool.deallocate(b, 5);
+
+    usm_pool_stats s = pool.get_stats();
+    pass &= s.allocations == 12 && s.deallocations == 12;
+    pass &= s.usm_allocations == 1 && s.cache_hits == 11;
+    pass &= s.bytes_in_use == 0 && s.bytes_cached == usm_pool::min_block;
+    pass &= s.peak_bytes_in_use == usm_pool::min_block;
+
+    // Oversized requests bypass the free lists
+    const std::size_t big = usm_pool::max_block / sizeof(complex<T>) + 1;
+    auto *c = pool.allocate<complex<T>>(big);
+    pool.deallocate(c, big);
+    s = pool.get_stats();
+    pass &= s.usm_allocations == 2 && s.bytes_cached == usm_pool::min_block;
+
+    pool.release();
+    pass &= pool.get_stats().bytes_cached == 0;
+
+    // Element counts whose byte size overflows are rejected
+    bool thrown = false;
+    try {
+      pool.allocate<complex<T>>(std::numeric_limits<std::size_t>::max() /
+                                    sizeof(complex<T>) +
+                                1);
+    } catch (const std::bad_array_new_length &) {
+      thrown = true;
+    }
+    pass &= thrown && pool.get_stats().allocations == 13;
+
+    if (!pass)
+      std::cerr << "usm_pool reuse fails for " << get_typename<T>() << "\n";
+    return pass;
+  }
+};
+
+template <typename T> struct test_pool_allocator {
+  bool operator()(sycl::queue &Q, T init_re, T init_im) {
+    bool pass = true;
+    usm_pool pool(Q, sycl::usm::alloc::shared);
+    constexpr std::size_t n = 16;
+
+    std::vector<complex<T>, complex_usm_allocator<T>> v(
+        n, complex<T>(init_re, init_im), complex_usm_allocator<T>(pool));
+    complex<T> *data = v.data();
+    Q.parallel_for(sycl::range<1>(n), [=](sycl::id<1> i) {
+       data[i] = sycl::ext::cplx::sqrt(data[i]);
+     }).wait();
+
+    std::complex<T> std_out{};
+    std_out = std::sqrt(init_std_complex(init_re, init_im));
+    for (std::size_t i = 0; i < n; ++i)
+      pass &= check_results(v[i], std_out, /*is_device*/ true);
+
+    // Rebound allocators draw from the same pool
+    usm_pool_allocator<float> rebound(v.get_allocator());
+    pass &= rebound == v.get_allocator();
+    pass &= pool.get_stats().bytes_in_use >= n * sizeof(complex<T>);
+
+    return pass;
+  }
+};
+
+int main() {
+  sycl::queue Q;
+
+  bool test_passes = true;
+  test_passes &= test_valid_types<test_pool_reuse>(Q, 0.42, -1.1);
+  test_passes &= test_valid_types<test_pool_allocator>(Q, 4.42, 2.02);
+
+  if (!test_passes)
+    std::cerr << "usm_pool test fails\n";
+
+  return !test_passes;
+}